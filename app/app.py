@@ -101,11 +101,11 @@ def load_data():
         try:
             generations_path = find_file(GENERATIONS_FILE)
             if not generations_path:
-                generations_df = pd.DataFrame(columns=['Generation', 'Front size', 'Best Cost', 'Best Time', 'Max Attractions'])
+                generations_df = pd.DataFrame(columns=['Generation', 'Front size', 'Best Cost', 'Best Time', 'Max Attractions', 'Hypervolume'])
             else:
                 generations_df = pd.read_csv(generations_path, sep=';', encoding='utf-8')
         except Exception:
-            generations_df = pd.DataFrame(columns=['Generation', 'Front size', 'Best Cost', 'Best Time', 'Max Attractions'])
+            generations_df = pd.DataFrame(columns=['Generation', 'Front size', 'Best Cost', 'Best Time', 'Max Attractions', 'Hypervolume'])
         
         return results_df, generations_df
     
@@ -0,0 +1,31 @@
+// File: include/allocation-tracker.hpp
+// Process-wide heap allocation counters (global operator new/delete hooks)
+
+#pragma once
+
+#include <cstdint>
+
+// Replacement operator new/delete are compiled in only when requested
+// (CMake option TOURIST_TRACK_ALLOCATIONS)
+#ifndef TOURIST_TRACK_ALLOCATIONS
+#define TOURIST_TRACK_ALLOCATIONS 0
+#endif
+
+namespace tourist {
+
+constexpr bool ALLOCATION_TRACKING_COMPILED = TOURIST_TRACK_ALLOCATIONS != 0;
+
+// Cumulative counts since program start (all zero when tracking is compiled out)
+struct AllocationCounts {
+    std::uint64_t allocations{0};
+    std::uint64_t deallocations{0};
+    std::uint64_t bytes{0};         // Bytes requested by all allocations
+};
+
+// Counts of every operator new/delete call in the process, on any thread
+AllocationCounts allocationCounts();
+
+// Peak resident set size of the process in bytes (0 if unknown)
+std::uint64_t peakResidentBytes();
+
+} // namespace tourist
@@ -0,0 +1,97 @@
+// File: include/archive-stream.hpp
+// Incremental NDJSON stream of Pareto archive insertions and removals
+
+#pragma once
+
+#include "utils.hpp"
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace tourist {
+
+// A route entering the archive
+struct ArchiveEntry {
+    std::uint64_t id{0};                        // Stable identifier, repeated by its removal event
+    double cost{0.0};
+    double time{0.0};
+    std::uint32_t attractions{0};
+    std::uint32_t neighborhoods{0};
+    std::vector<int> sequence;                  // Attraction indices in visit order
+    std::vector<utils::TransportMode> modes;    // Mode of each segment (sequence.size() - 1)
+};
+
+// When buffered events are written out; whichever limit is reached first triggers a flush
+struct StreamFlushPolicy {
+    size_t max_events{256};                 // Buffered events
+    size_t max_bytes{64 * 1024};            // Buffered bytes
+    double max_interval_seconds{1.0};       // Time since the last flush (0 flushes every generation)
+};
+
+/**
+ * @class ArchiveStream
+ * @brief Writes archive changes as newline-delimited JSON while a run progresses
+ *
+ * One object per line, distinguished by "event":
+ *   {"event":"run_start"}
+ *   {"event":"insert","generation":G,"id":"<16 hex digits>","cost":C,"time":T,
+ *    "attractions":A,"neighborhoods":N,"sequence":["name",...],"modes":["walk"|"car",...]}
+ *   {"event":"remove","generation":G,"id":"<16 hex digits>"}
+ *   {"event":"run_end","generations":G}
+ *   {"event":"run_resume","generation":G}
+ *
+ * G counts the generations completed when the change was observed (0 for the
+ * initial population). Replaying inserts and removes in file order reconstructs the archive at any
+ * generation. A run resumed from a checkpoint appends to the stream of the
+ * interrupted run, starting with run_resume: its archive restarts from the
+ * checkpointed archive, so readers drop the archive replayed so far and
+ * rebuild it from the inserts that follow. Events are kept in a bounded buffer and appended to the file
+ * according to the flush policy, so readers tailing the file see whole lines only.
+ */
+class ArchiveStream {
+public:
+    // poi_names maps attraction indices in ArchiveEntry::sequence to names
+    ArchiveStream(std::string path, std::vector<std::string> poi_names,
+                  StreamFlushPolicy policy = StreamFlushPolicy());
+    ~ArchiveStream();
+
+    ArchiveStream(const ArchiveStream&) = delete;
+    ArchiveStream& operator=(const ArchiveStream&) = delete;
+
+    // Truncates the file and writes run_start; throws std::runtime_error if it cannot be opened
+    void open();
+
+    // Appends run_resume to the file of an interrupted run (created if missing); throws like open()
+    void resume(size_t generation);
+
+    void insert(size_t generation, const ArchiveEntry& entry);
+    void remove(size_t generation, std::uint64_t id);
+
+    // Called once per generation so the time limit applies even without new events
+    void endGeneration();
+
+    // Writes run_end, flushes and closes the file
+    void close(size_t generations);
+
+    // Writes buffered events to the file
+    void flush();
+
+private:
+    void openFile(std::ios::openmode mode);
+    void append(const std::string& line);
+    void appendId(std::uint64_t id);
+    void appendString(const std::string& value);
+
+    std::string path_;
+    std::vector<std::string> poi_names_;
+    StreamFlushPolicy policy_;
+    std::ofstream file_;
+    std::string buffer_;
+    std::string line_;          // Scratch line reused by every event
+    size_t buffered_events_{0};
+    std::chrono::steady_clock::time_point last_flush_;
+};
+
+} // namespace tourist
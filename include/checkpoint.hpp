@@ -0,0 +1,89 @@
+// File: include/checkpoint.hpp
+// Binary checkpoints of an optimizer run and a background checkpoint writer
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tourist {
+
+/**
+ * @brief Snapshot of an optimizer run
+ *
+ * Population members and external archive entries are stored as fixed-size
+ * records copied bytewise from the optimizer's individuals, so record_size
+ * doubles as a layout check.
+ *
+ * File layout (little-endian, as written by the host):
+ *   char[8]  magic "TRCKPT01"
+ *   u32      format version
+ *   u32      record_size
+ *   u64      parameter_hash
+ *   u64      generation
+ *   u64      evaluations
+ *   u64      length of rng_state, followed by its bytes
+ *   u64      record count, followed by count * record_size bytes
+ *   u64      archive record count, followed by count * record_size bytes
+ *   u64      FNV-1a checksum of all preceding bytes
+ */
+struct CheckpointData {
+    std::uint32_t record_size{0};       // Size of one population record in bytes
+    std::uint64_t parameter_hash{0};    // Fingerprint of the settings the run depends on
+    std::uint64_t generation{0};        // Last completed generation
+    std::uint64_t evaluations{0};       // Objective evaluations performed so far
+    std::string rng_state;              // Serialized random engine
+    std::vector<unsigned char> records; // Population records, back to back
+    std::vector<unsigned char> archive; // External archive records, back to back
+
+    size_t recordCount() const { return record_size == 0 ? 0 : records.size() / record_size; }
+    size_t archiveCount() const { return record_size == 0 ? 0 : archive.size() / record_size; }
+};
+
+class Checkpoint {
+public:
+    // Writes atomically (temporary file, then rename); throws std::runtime_error on failure
+    static void write(const std::string& path, const CheckpointData& data);
+
+    // Returns false if the file does not exist; throws std::runtime_error if it is corrupt
+    static bool read(const std::string& path, CheckpointData& data);
+};
+
+/**
+ * @class CheckpointWriter
+ * @brief Writes checkpoints on a background thread
+ *
+ * submit() only moves the snapshot into a single pending slot; if the thread is
+ * still busy with an older snapshot when a new one arrives, the older pending one
+ * is replaced, since only the latest state matters.
+ */
+class CheckpointWriter {
+public:
+    explicit CheckpointWriter(std::string path);
+    ~CheckpointWriter();
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    void submit(CheckpointData data);
+
+    // Writes any pending snapshot and stops the thread
+    void close();
+
+private:
+    void work();
+
+    std::string path_;
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    CheckpointData pending_;
+    bool has_pending_{false};
+    bool stop_{false};
+    std::thread thread_;
+};
+
+} // namespace tourist
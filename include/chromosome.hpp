@@ -0,0 +1,237 @@
+// File: include/chromosome.hpp
+// Fixed-capacity route chromosome with inline storage and a membership bitmask
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tourist {
+
+// SplitMix64 finalizer: spreads the bits of an accumulated hash
+inline std::uint64_t mixHash(std::uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/**
+ * @class FixedChromosome
+ * @brief Ordered sequence of distinct attraction ids stored inline
+ *
+ * Routes are short (a handful of attractions) while the attraction set is small,
+ * so a chromosome fits in a few dozen bytes: the genes are kept in a fixed array of
+ * narrow ids and a bitmask over all possible ids records which attractions are
+ * present. Membership tests are O(1) and the type is trivially copyable, so
+ * individuals can be copied with a plain memcpy.
+ *
+ * @tparam Capacity Maximum number of genes (attractions) in a route
+ * @tparam MaxGenes Number of distinct gene ids (attractions) that can be represented
+ */
+template <size_t Capacity, size_t MaxGenes = 256>
+class FixedChromosome {
+    static_assert(Capacity > 0 && Capacity <= 255, "Capacity must fit in a byte");
+    static_assert(MaxGenes > 0 && MaxGenes <= 65536, "Gene ids must fit in 16 bits");
+
+public:
+    // Narrowest unsigned type able to hold every gene id
+    using Gene = std::conditional_t<(MaxGenes <= 256), std::uint8_t, std::uint16_t>;
+
+    static constexpr size_t CAPACITY = Capacity;
+    static constexpr size_t MAX_GENES = MaxGenes;
+
+    FixedChromosome() = default;
+
+    // Build from a sequence of attraction indices (duplicates are rejected)
+    explicit FixedChromosome(const std::vector<int>& genes) {
+        if (genes.size() > Capacity) {
+            throw std::invalid_argument("Chromosome exceeds its fixed capacity");
+        }
+        for (int gene : genes) {
+            if (gene < 0 || static_cast<size_t>(gene) >= MaxGenes || !push_back(static_cast<Gene>(gene))) {
+                throw std::invalid_argument("Invalid or repeated gene in chromosome");
+            }
+        }
+    }
+
+    // Capacity and size
+    static constexpr size_t capacity() { return Capacity; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool full() const { return size_ == Capacity; }
+
+    // Element access
+    Gene operator[](size_t pos) const { return genes_[pos]; }
+    const Gene* data() const { return genes_.data(); }
+    const Gene* begin() const { return genes_.data(); }
+    const Gene* end() const { return genes_.data() + size_; }
+
+    // O(1) membership test through the bitmask
+    bool contains(size_t gene) const {
+        return gene < MaxGenes && (mask_[gene / 64] >> (gene % 64)) & 1u;
+    }
+
+    // Append a gene; returns false if the chromosome is full or already holds it
+    bool push_back(Gene gene) {
+        return insert(size_, gene);
+    }
+
+    // Insert a gene before position pos; returns false if full or already present
+    bool insert(size_t pos, Gene gene) {
+        if (full() || pos > size_ || contains(gene)) return false;
+        std::memmove(&genes_[pos + 1], &genes_[pos], (size_ - pos) * sizeof(Gene));
+        genes_[pos] = gene;
+        ++size_;
+        setBit(gene);
+        return true;
+    }
+
+    // Remove the gene at position pos and return it
+    Gene erase(size_t pos) {
+        Gene gene = genes_[pos];
+        std::memmove(&genes_[pos], &genes_[pos + 1], (size_ - pos - 1) * sizeof(Gene));
+        --size_;
+        clearBit(gene);
+        return gene;
+    }
+
+    // Exchange two positions (membership is unchanged)
+    void swap(size_t pos1, size_t pos2) {
+        Gene tmp = genes_[pos1];
+        genes_[pos1] = genes_[pos2];
+        genes_[pos2] = tmp;
+    }
+
+    // Keep only the first n genes
+    void truncate(size_t n) {
+        while (size_ > n) {
+            clearBit(genes_[--size_]);
+        }
+    }
+
+    void clear() {
+        size_ = 0;
+        mask_.fill(0);
+    }
+
+    // Widen back to the index representation used by the rest of the code
+    std::vector<int> toVector() const {
+        return std::vector<int>(begin(), end());
+    }
+
+    // 64-bit hash of the gene sequence (order-sensitive)
+    std::uint64_t hash() const {
+        return hashes().first;
+    }
+
+    // Hashes of the sequence and of its reverse, accumulated in a single pass.
+    // The second value equals reversed().hash().
+    std::pair<std::uint64_t, std::uint64_t> hashes() const {
+        // Forward: size * P^n + sum (g_i + 1) * P^(n-1-i); reverse weights gene i by P^i instead
+        std::uint64_t forward = size_;
+        std::uint64_t reverse = 0;
+        std::uint64_t power = 1;
+        for (size_t i = 0; i < size_; ++i) {
+            forward = forward * HASH_MULTIPLIER + genes_[i] + 1;
+            reverse += (genes_[i] + std::uint64_t(1)) * power;
+            power *= HASH_MULTIPLIER;
+        }
+        reverse += size_ * power;
+        return {mixHash(forward), mixHash(reverse)};
+    }
+
+    // Same genes in the opposite visiting order
+    FixedChromosome reversed() const {
+        FixedChromosome result = *this;
+        for (size_t i = 0; i < size_ / 2; ++i) {
+            result.swap(i, size_ - 1 - i);
+        }
+        return result;
+    }
+
+    bool operator==(const FixedChromosome& other) const {
+        return size_ == other.size_ && std::memcmp(genes_.data(), other.genes_.data(), size_ * sizeof(Gene)) == 0;
+    }
+    bool operator!=(const FixedChromosome& other) const { return !(*this == other); }
+
+private:
+    static constexpr size_t MASK_WORDS = (MaxGenes + 63) / 64;
+    static constexpr std::uint64_t HASH_MULTIPLIER = 0x100000001b3ULL;  // FNV-1a 64-bit prime
+
+    void setBit(size_t gene) { mask_[gene / 64] |= std::uint64_t(1) << (gene % 64); }
+    void clearBit(size_t gene) { mask_[gene / 64] &= ~(std::uint64_t(1) << (gene % 64)); }
+
+    std::array<Gene, Capacity> genes_{};          // Attraction ids in visit order
+    std::uint8_t size_{0};                        // Number of genes in use
+    std::array<std::uint64_t, MASK_WORDS> mask_{}; // Bit g is set iff gene g is present
+};
+
+/**
+ * @class ChromosomeSet
+ * @brief Open-addressing set of chromosomes keyed by their 64-bit hash
+ *
+ * Hashes select the slot; equal hashes are confirmed by comparing the genes,
+ * so colliding chromosomes are never treated as duplicates. The table doubles
+ * when it becomes half full.
+ */
+template <typename Chromosome>
+class ChromosomeSet {
+public:
+    size_t size() const { return size_; }
+
+    bool contains(std::uint64_t hash, const Chromosome& chromosome) const {
+        if (slots_.empty()) return false;
+        for (size_t i = hash & (slots_.size() - 1); slots_[i].occupied; i = (i + 1) & (slots_.size() - 1)) {
+            if (slots_[i].hash == hash && slots_[i].chromosome == chromosome) return true;
+        }
+        return false;
+    }
+
+    // Returns false if the chromosome was already present
+    bool insert(std::uint64_t hash, const Chromosome& chromosome) {
+        if (2 * (size_ + 1) > slots_.size()) grow();
+        size_t i = hash & (slots_.size() - 1);
+        for (; slots_[i].occupied; i = (i + 1) & (slots_.size() - 1)) {
+            if (slots_[i].hash == hash && slots_[i].chromosome == chromosome) return false;
+        }
+        slots_[i] = {hash, true, chromosome};
+        ++size_;
+        return true;
+    }
+
+    // Empties the set but keeps its storage
+    void clear() {
+        for (auto& slot : slots_) slot.occupied = false;
+        size_ = 0;
+    }
+
+private:
+    struct Slot {
+        std::uint64_t hash{0};
+        bool occupied{false};
+        Chromosome chromosome{};
+    };
+
+    void grow() {
+        std::vector<Slot> old = std::move(slots_);
+        slots_.assign(old.empty() ? 64 : old.size() * 2, Slot());
+        size_ = 0;
+        for (const auto& slot : old) {
+            if (slot.occupied) insert(slot.hash, slot.chromosome);
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t size_{0};
+};
+
+} // namespace tourist
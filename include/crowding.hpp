@@ -0,0 +1,52 @@
+// File: include/crowding.hpp
+// Crowding distance assignment over column-major objective data, based on:
+// "A Fast and Elitist Multiobjective Genetic Algorithm: NSGA-II" by Deb et al., 2002 (Section III-B)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tourist {
+
+/**
+ * @class CrowdingDistance
+ * @brief Computes crowding distances of one front stored as objective columns
+ *
+ * The caller loads the objective values of the front into a column-major buffer
+ * (all values of objective 0, then objective 1, ...). Each objective is ordered
+ * through an index permutation over its column, so no individual is moved and the
+ * distances are accumulated in a contiguous array. The buffers are kept between
+ * calls, so steady use does not allocate.
+ */
+class CrowdingDistance {
+public:
+    /**
+     * @brief Prepares storage for a front
+     *
+     * @param n Number of points in the front
+     * @param m Number of objectives
+     * @return Column-major buffer of n * m values to be filled by the caller
+     */
+    double* reset(size_t n, size_t m);
+
+    /**
+     * @brief Computes the crowding distance of every loaded point
+     *
+     * Boundary points of each objective get an infinite distance; interior points
+     * accumulate the normalized gap between their neighbours in every objective.
+     *
+     * @return Distances indexed like the loaded points
+     */
+    const std::vector<double>& compute();
+
+private:
+    size_t n_{0};
+    size_t m_{0};
+    std::vector<double> columns_;     // values[obj * n + i]
+    std::vector<double> distances_;   // distance of point i
+    std::vector<std::uint32_t> order_; // permutation sorting one column
+};
+
+} // namespace tourist
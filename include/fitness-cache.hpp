@@ -0,0 +1,108 @@
+// File: include/fitness-cache.hpp
+// Bounded memoization of objective evaluations keyed by a 64-bit hash
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tourist {
+
+/**
+ * @class FitnessCache
+ * @brief Fixed-size open-addressing table mapping evaluated keys to their fitness
+ *
+ * Slots are probed linearly from the hash position for at most MAX_PROBES steps.
+ * A lookup only hits if both the hash and the full key match, so hash collisions
+ * never return a wrong fitness. When all probed slots are taken, the slot at the
+ * hash position is overwritten, which keeps the memory footprint fixed.
+ *
+ * @tparam Key Trivially copyable key with operator==
+ * @tparam Value Cached fitness
+ */
+template <typename Key, typename Value>
+class FitnessCache {
+public:
+    // Lookup statistics
+    struct Stats {
+        size_t lookups{0};      // Calls to find()
+        size_t hits{0};         // Lookups answered from the cache
+        size_t insertions{0};   // Values stored
+        size_t evictions{0};    // Values overwritten to make room
+        
+        double hitRate() const {
+            return lookups == 0 ? 0.0 : static_cast<double>(hits) / lookups;
+        }
+    };
+    
+    // Capacity is rounded up to a power of two; zero disables the cache
+    explicit FitnessCache(size_t capacity = 0) {
+        if (capacity > 0) {
+            size_t size = 1;
+            while (size < capacity) size <<= 1;
+            slots_.resize(size);
+            mask_ = size - 1;
+        }
+    }
+    
+    bool enabled() const { return !slots_.empty(); }
+    size_t capacity() const { return slots_.size(); }
+    const Stats& stats() const { return stats_; }
+    
+    // Returns the cached value for the key, or nullptr on a miss
+    const Value* find(std::uint64_t hash, const Key& key) {
+        ++stats_.lookups;
+        for (size_t probe = 0; probe < MAX_PROBES; ++probe) {
+            const Slot& slot = slots_[(hash + probe) & mask_];
+            if (!slot.occupied) return nullptr;
+            if (slot.hash == hash && slot.key == key) {
+                ++stats_.hits;
+                return &slot.value;
+            }
+        }
+        return nullptr;
+    }
+    
+    // Stores a value, replacing an existing entry for the same key
+    void insert(std::uint64_t hash, const Key& key, const Value& value) {
+        Slot* target = &slots_[hash & mask_];
+        for (size_t probe = 0; probe < MAX_PROBES; ++probe) {
+            Slot& slot = slots_[(hash + probe) & mask_];
+            if (!slot.occupied || (slot.hash == hash && slot.key == key)) {
+                target = &slot;
+                break;
+            }
+        }
+        
+        if (target->occupied && !(target->hash == hash && target->key == key)) {
+            ++stats_.evictions;
+        }
+        target->hash = hash;
+        target->occupied = true;
+        target->key = key;
+        target->value = value;
+        ++stats_.insertions;
+    }
+    
+    void clear() {
+        for (auto& slot : slots_) slot.occupied = false;
+        stats_ = Stats();
+    }
+
+private:
+    static constexpr size_t MAX_PROBES = 8;
+    
+    struct Slot {
+        std::uint64_t hash{0};
+        bool occupied{false};
+        Key key{};
+        Value value{};
+    };
+    
+    std::vector<Slot> slots_;
+    size_t mask_{0};
+    Stats stats_;
+};
+
+} // namespace tourist
@@ -0,0 +1,129 @@
+// File: include/front-metrics.hpp
+// Hypervolume, quality indicators and binary coverage of the fronts in results files
+
+#pragma once
+
+#include "quality-indicators.hpp"
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace tourist {
+namespace utils {
+
+/**
+ * @struct ResultFront
+ * @brief Non-dominated objective vectors read from one results file
+ *
+ * Points are stored row-major as [cost, time, -attractions, -neighborhoods],
+ * so every objective is minimized, as in the results of the optimizer.
+ */
+struct ResultFront {
+    static constexpr size_t NUM_OBJECTIVES = 4;
+
+    std::string algorithm;       // Display name derived from the file name
+    std::string path;            // File the front was read from
+    size_t solutions{0};         // Solutions in the file, dominated ones included
+    std::vector<double> values;  // Non-dominated points, NUM_OBJECTIVES values each
+
+    size_t size() const { return values.size() / NUM_OBJECTIVES; }
+    const double* point(size_t index) const { return &values[index * NUM_OBJECTIVES]; }
+};
+
+// Hypervolume of one front
+struct FrontHypervolume {
+    double normalized{0.0};  // Measured with objectives scaled to the ideal-nadir box
+    double raw{0.0};         // Measured in the original units
+    double ratio{0.0};       // Raw hypervolume over that of the reference front
+};
+
+/**
+ * @class FrontMetrics
+ * @brief Scores the fronts of several results files against each other
+ *
+ * Results files are the nsga2-resultados.csv layout (or its .bin version, see
+ * ResultsFormat). The fronts of all files are merged into a reference front;
+ * its bounds, widened to the problem's theoretical ideal and nadir points,
+ * normalize the objectives. The hypervolume reference point lies 10% beyond the
+ * nadir in cost and time and at 0.9 attractions and neighborhoods.
+ */
+class FrontMetrics {
+public:
+    using Point = std::array<double, ResultFront::NUM_OBJECTIVES>;
+
+    // Problem bounds, [cost, time, -attractions, -neighborhoods]
+    static constexpr Point IDEAL_POINT{0.0, 60.0, -10.0, -10.0};
+    static constexpr Point NADIR_POINT{500.0, 840.0, -1.0, -1.0};
+    static constexpr Point REFERENCE_POINT{500.0 * 1.1, 840.0 * 1.1, -0.9, -0.9};
+
+    /**
+     * @brief Reads the front of a results file (.csv or .bin)
+     *
+     * @throws std::runtime_error if the file cannot be read or lacks the objective columns
+     */
+    static ResultFront load(const std::string& path);
+
+    /**
+     * @brief Reads several results files on up to threads threads (0 = hardware concurrency)
+     *
+     * Fronts come back in the order of the paths.
+     */
+    static std::vector<ResultFront> load(const std::vector<std::string>& paths, size_t threads = 0);
+
+    /**
+     * @brief Lists the *resultados.csv files of a directory, sorted by name
+     */
+    static std::vector<std::string> findResultFiles(const std::string& directory);
+
+    // Display name of the algorithm behind a results file, e.g. "nsga2-resultados.csv" -> "NSGA-II",
+    // "run_3-resultados.bin" -> "Run 3"
+    static std::string algorithmName(const std::string& path);
+
+    // Non-dominated points of a row-major set of minimized points, duplicates kept once
+    static std::vector<double> nondominated(const std::vector<double>& values);
+
+    // Non-dominated points of the union of the fronts
+    static std::vector<double> referenceFront(const std::vector<ResultFront>& fronts);
+
+    /**
+     * @brief Hypervolume of every front, measured on up to threads threads
+     *
+     * @param fronts Fronts to score
+     * @param reference_front Front whose bounds normalize the objectives and
+     *                        whose hypervolume is the denominator of the ratio
+     */
+    static std::vector<FrontHypervolume> hypervolumes(const std::vector<ResultFront>& fronts,
+                                                      const std::vector<double>& reference_front,
+                                                      size_t threads = 0);
+
+    /**
+     * @brief GD, IGD, IGD+, epsilon and spread of every front, on up to threads threads
+     *
+     * Measured on objectives normalized as for the hypervolume, so every
+     * objective weighs the same in the distances; reference_front is the
+     * reference set R of all indicators.
+     */
+    static std::vector<IndicatorValues> indicators(const std::vector<ResultFront>& fronts,
+                                                   const std::vector<double>& reference_front,
+                                                   size_t threads = 0);
+
+    /**
+     * @brief Binary coverage C(A, B) (Zitzler et al., 2003)
+     *
+     * Fraction of the points of b weakly dominated by some point of a; 0 when
+     * either front is empty.
+     */
+    static double coverage(const ResultFront& a, const ResultFront& b);
+
+    /**
+     * @brief C(A, B) for every ordered pair of fronts, on up to threads threads
+     *
+     * @return Row-major matrix: entry [a * fronts.size() + b] is C(fronts[a], fronts[b]),
+     *         with 0 on the diagonal
+     */
+    static std::vector<double> coverageMatrix(const std::vector<ResultFront>& fronts, size_t threads = 0);
+};
+
+} // namespace utils
+} // namespace tourist
@@ -0,0 +1,87 @@
+// File: include/hypervolume-estimator.hpp
+// Monte Carlo hypervolume estimate with a confidence interval
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "hypervolume.hpp"
+
+namespace tourist {
+namespace utils {
+
+/**
+ * @brief Result of a Monte Carlo hypervolume estimate
+ *
+ * The interval is the Wilson score interval of the hit ratio, scaled by the
+ * volume of the sampling box.
+ */
+struct HypervolumeEstimate {
+    double value{0.0};          // Estimated hypervolume
+    double lower{0.0};          // Lower end of the confidence interval
+    double upper{0.0};          // Upper end of the confidence interval
+    double box_volume{0.0};     // Volume of the box the samples were drawn from
+    std::uint64_t samples{0};   // Samples drawn
+    std::uint64_t hits{0};      // Samples dominated by the front
+
+    // Half width of the interval relative to the estimate (0 for an exact result)
+    double relativeError() const;
+};
+
+// Sampling budget and stopping rule of a HypervolumeEstimator
+struct EstimatorOptions {
+    std::uint64_t max_samples{1u << 22};    // Sample budget
+    double target_relative_error{0.0};      // Stop once relativeError() is at most this (0 = use the budget)
+    double max_seconds{0.0};                // Stop after the round that exceeds this time (0 = no limit)
+    double confidence{0.95};                // Confidence level of the interval
+    size_t threads{0};                      // Worker threads (0 = hardware concurrency)
+    size_t batch_size{4096};                // Samples per batch
+    std::uint64_t seed{0x5eed};             // Seed of the sample streams
+};
+
+/**
+ * @class HypervolumeEstimator
+ * @brief Estimates the hypervolume by sampling the box between the front and the reference
+ *
+ * Samples are drawn uniformly from the box spanned by the best value of every
+ * objective and the reference point; the fraction dominated by some point of the
+ * front, times the box volume, estimates the hypervolume. The front is stored as
+ * one column per objective and each sample is tested against blocks of points
+ * with a branch-free loop the compiler vectorizes.
+ *
+ * Samples come in batches whose random streams depend only on the seed and the
+ * batch index. Batches are spread over threads in rounds, but their hits are
+ * added in batch order and the precision target is checked after each batch,
+ * so a given seed and budget give the same estimate for any number of threads.
+ * Only max_seconds is checked between rounds, and a run it cuts short depends
+ * on the timing.
+ */
+class HypervolumeEstimator {
+public:
+    using Options = EstimatorOptions;
+
+    explicit HypervolumeEstimator(Options options = Options());
+
+    const Options& getOptions() const { return options_; }
+
+    /**
+     * @brief Estimates the hypervolume of points stored row-major in one buffer
+     *
+     * Senses and reference follow HypervolumeCalculator::calculate. Points that do
+     * not dominate the reference are ignored.
+     */
+    HypervolumeEstimate estimate(const double* values, size_t num_points, size_t num_objectives,
+                                 const double* reference_point,
+                                 unsigned maximize_mask = HypervolumeCalculator::DEFAULT_MAXIMIZE_MASK) const;
+
+    HypervolumeEstimate estimate(const std::vector<std::vector<double>>& points,
+                                 const std::vector<double>& reference_point,
+                                 unsigned maximize_mask = HypervolumeCalculator::DEFAULT_MAXIMIZE_MASK) const;
+
+private:
+    Options options_;
+};
+
+} // namespace utils
+} // namespace tourist
@@ -0,0 +1,62 @@
+// File: include/hypervolume-tracker.hpp
+// Hypervolume of a changing point set, updated point by point
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "hypervolume.hpp"
+
+namespace tourist {
+namespace utils {
+
+/**
+ * @class HypervolumeTracker
+ * @brief Keeps the hypervolume of a set of points as points enter and leave it
+ *
+ * Adding or removing a point changes the volume by exactly its exclusive
+ * contribution with respect to the other points, so each update only measures
+ * the region the point dominates alone (HypervolumeCalculator::contribution)
+ * instead of the whole set. Points are identified by caller-chosen ids.
+ *
+ * Sums of many updates accumulate rounding; refresh() recomputes the volume
+ * from scratch when an exact figure is needed.
+ */
+class HypervolumeTracker {
+public:
+    HypervolumeTracker(std::vector<double> reference_point,
+                       unsigned maximize_mask = HypervolumeCalculator::DEFAULT_MAXIMIZE_MASK);
+
+    size_t dimensions() const { return reference_.size(); }
+    size_t size() const { return ids_.size(); }
+    bool contains(std::uint64_t id) const { return rows_.count(id) != 0; }
+
+    // Current hypervolume of the tracked points
+    double volume() const { return volume_; }
+
+    // Adds a point (dimensions() values) and returns the volume it added;
+    // throws std::invalid_argument if the id is already tracked
+    double insert(std::uint64_t id, const double* point);
+
+    // Removes a point and returns the volume it took away (0 if the id is unknown)
+    double remove(std::uint64_t id);
+
+    // Recomputes the volume of the tracked points from scratch and returns it
+    double refresh();
+
+    void clear();
+
+private:
+    std::vector<double> reference_;
+    unsigned maximize_mask_;
+    std::vector<double> values_;                        // Row-major points
+    std::vector<std::uint64_t> ids_;                    // Id of each row
+    std::unordered_map<std::uint64_t, size_t> rows_;    // Row of each id
+    std::vector<double> removed_;                       // Scratch copy of a removed point
+    double volume_{0.0};
+};
+
+} // namespace utils
+} // namespace tourist
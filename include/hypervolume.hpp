@@ -3,11 +3,13 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <algorithm>
 #include <functional>
 #include <numeric>
 #include <limits>
 #include <cmath>
+#include <cstdint>
 #include "models.hpp"
 
 namespace tourist {
@@ -23,9 +25,26 @@ namespace utils {
  * The algorithm works by processing points one objective at a time, creating slices through the 
  * hypervolume. Each slice is processed recursively in fewer dimensions until reaching the base case
  * of two dimensions, which is handled as a special case for efficiency.
+ *
+ * Three and four objectives, the sizes used by the project, are handled by
+ * dedicated exact algorithms instead of slicing to the end: an O(n log n)
+ * staircase sweep (Beume et al., "On the Complexity of Computing the Hypervolume
+ * Indicator", 2009) and, for four, a sweep along the first objective that adds
+ * each point's 3D exclusive contribution computed on its WFG limit set.
+ *
+ * Objective senses are given as a bit mask (bit i set: objective i is maximized).
+ * The recursion is compiled separately for every mask of 2, 3 and 4 objectives,
+ * so the kernels carry no per-element sense tests; other dimensions fall back to
+ * a generic kernel that reads the mask at run time.
  */
 class HypervolumeCalculator {
 public:
+    /// Sense mask used by the overloads that do not take one: attractions (objective 2) maximized
+    static constexpr unsigned DEFAULT_MAXIMIZE_MASK = 1u << 2;
+
+    /// Largest number of objectives a sense mask can describe
+    static constexpr size_t MAX_OBJECTIVES = 32;
+
     /**
      * @brief Calculates the hypervolume of a set of solutions
      * 
@@ -36,108 +55,193 @@ public:
     static double calculate(const std::vector<Solution>& solutions, 
                            const std::vector<double>& reference_point);
 
-private:
     /**
-     * @brief Internal structure to represent a point with its objective values
-     */
-    struct Point {
-        std::vector<double> objectives;
-        
-        /**
-         * @brief Constructs a Point from a solution
-         * @param solution The solution to convert
-         */
-        explicit Point(const Solution& solution);
-        
-        /**
-         * @brief Checks if this point dominates another point in the remaining objectives [k...n]
-         * 
-         * @param other The other point to compare against
-         * @param k Starting objective index
-         * @return true if this point dominates the other, false otherwise
-         */
-        bool dominates(const Point& other, size_t k) const;
-        
-        /**
-         * @brief Checks if this point is dominated by another point in the remaining objectives [k...n]
-         * 
-         * @param other The other point to compare against
-         * @param k Starting objective index
-         * @return true if this point is dominated by the other, false otherwise
-         */
-        bool isDominatedBy(const Point& other, size_t k) const;
-    };
+     * @brief Calculates the hypervolume of a set of objective vectors
+     * 
+     * Uses the same objective senses as the solution overload unless a mask is
+     * given. The reference point is used as given: points that do not dominate it simply contribute no volume.
+     * 
+     * @param points Objective vectors, one per point
+     * @param reference_point The reference point
+     * @param maximize_mask Bit i set if objective i is maximized
+     * @return The hypervolume value
+     */
+    static double calculate(const std::vector<std::vector<double>>& points, 
+                           const std::vector<double>& reference_point,
+                           unsigned maximize_mask = DEFAULT_MAXIMIZE_MASK);
 
     /**
-     * @brief Result structure for the recursive hypervolume calculation
+     * @brief Calculates the hypervolume of points stored row-major in one buffer
+     * 
+     * values[i * num_objectives + j] is objective j of point i. The buffer is read
+     * in place; no per-point copies are made.
+     * 
+     * @param values Objective values, num_points * num_objectives entries
+     * @param num_points Number of points
+     * @param num_objectives Number of objectives (entries of the reference point)
+     * @param reference_point The reference point
+     * @param maximize_mask Bit i set if objective i is maximized; bits at or above
+     *                      num_objectives are ignored
+     * @return The hypervolume value
      */
-    struct HVResult {
-        double volume;      ///< The calculated hypervolume
-        std::vector<Point> points; ///< The contributing points (after removing dominated points)
-    };
+    static double calculate(const double* values, size_t num_points, size_t num_objectives,
+                           const double* reference_point,
+                           unsigned maximize_mask = DEFAULT_MAXIMIZE_MASK);
 
     /**
-     * @brief The main recursive HSO algorithm implementation
+     * @brief Calculates the hypervolume of a large front on several threads
      * 
-     * @param points Vector of points
-     * @param k Current dimension being processed (starting from 0)
-     * @param n Total number of dimensions
-     * @param reference_point The reference point
-     * @return HVResult containing the calculated hypervolume and relevant points
+     * With four objectives, the sweep along the first objective hands the
+     * exclusive 3D contributions of the points to a pool of threads, in rounds
+     * of eight points per thread. With five or more, the pool measures the
+     * top-level HSO slices of the first objective. Each thread has its own
+     * scratch buffers, and the volumes are added in the serial order, so the
+     * result equals calculate() bit for bit for any number of threads. Fronts of
+     * two or three objectives, and fronts under 256 points, are measured on the
+     * calling thread. Meant for scoring large reference fronts.
+     * 
+     * @param values Objective values, num_points * num_objectives entries
+     * @param num_points Number of points
+     * @param num_objectives Number of objectives
+     * @param reference_point The reference point, used as given
+     * @param maximize_mask Bit i set if objective i is maximized
+     * @param threads Threads to use, the calling one included (0 = hardware concurrency)
+     * @return The hypervolume value
      */
-    static HVResult hso(std::vector<Point> points, size_t k, size_t n, 
-                        const std::vector<double>& reference_point);
-    
+    static double calculateParallel(const double* values, size_t num_points, size_t num_objectives,
+                                    const double* reference_point,
+                                    unsigned maximize_mask = DEFAULT_MAXIMIZE_MASK,
+                                    size_t threads = 0);
+
+    /**
+     * @brief Calculates the hypervolume of a set of objective vectors on several threads
+     * 
+     * @param points Objective vectors, one per point
+     * @param reference_point The reference point, used as given
+     * @param maximize_mask Bit i set if objective i is maximized
+     * @param threads Threads to use, the calling one included (0 = hardware concurrency)
+     * @return The hypervolume value
+     */
+    static double calculateParallel(const std::vector<std::vector<double>>& points,
+                                    const std::vector<double>& reference_point,
+                                    unsigned maximize_mask = DEFAULT_MAXIMIZE_MASK,
+                                    size_t threads = 0);
+
     /**
-     * @brief Slices the hypervolume in the k-th dimension
+     * @brief Calculates the exclusive hypervolume contribution of every solution
      * 
-     * Takes a list of points and creates slices through the hypervolume in the k-th dimension.
-     * Each slice is processed recursively in dimensions k+1...n.
+     * The contribution of a point is the volume dominated by it and by no other
+     * point, HV(S) - HV(S \ {p}); a point weakly dominated by another one (a
+     * duplicate included) contributes nothing. All contributions come from one
+     * call: for two objectives a single sweep over a non-dominated set, otherwise
+     * each point's box minus the volume of its limit set (the other points clipped
+     * to the box, While et al., WFG), measured by the 3D and 4D algorithms. The
+     * reference point is adjusted as in calculate().
      * 
-     * @param points Vector of points to process
-     * @param k Current dimension being processed (starting from 0)
-     * @param n Total number of dimensions
+     * @param solutions Vector of solutions
      * @param reference_point The reference point
-     * @return The hypervolume of the points
+     * @return Contributions, one per solution
      */
-    static double slice(std::vector<Point>& points, size_t k, size_t n,
-                       const std::vector<double>& reference_point);
-    
+    static std::vector<double> contributions(const std::vector<Solution>& solutions,
+                                             const std::vector<double>& reference_point);
+
     /**
-     * @brief Special case handler for 2D hypervolume calculation
+     * @brief Calculates the exclusive hypervolume contribution of every objective vector
      * 
-     * A fast implementation for the 2D case which is used as the base case
-     * for the recursive algorithm.
+     * @param points Objective vectors, one per point
+     * @param reference_point The reference point, used as given
+     * @param maximize_mask Bit i set if objective i is maximized
+     * @return Contributions, one per point
+     */
+    static std::vector<double> contributions(const std::vector<std::vector<double>>& points,
+                                             const std::vector<double>& reference_point,
+                                             unsigned maximize_mask = DEFAULT_MAXIMIZE_MASK);
+
+    /**
+     * @brief Calculates the exclusive contribution of points stored row-major in one buffer
      * 
-     * @param points Vector of points (assumed to be in 2D)
-     * @param reference_point The reference point (for the 2D case)
-     * @param isMaximization Whether the second dimension is to be maximized
-     * @return The 2D hypervolume
+     * @param values Objective values, num_points * num_objectives entries
+     * @param num_points Number of points
+     * @param num_objectives Number of objectives
+     * @param reference_point The reference point, used as given
+     * @param contributions Output, num_points entries
+     * @param maximize_mask Bit i set if objective i is maximized
      */
-    static double calculate2D(const std::vector<Point>& points, 
-                             const std::vector<double>& reference_point,
-                             bool isMaximization = false);
-    
+    static void contributions(const double* values, size_t num_points, size_t num_objectives,
+                              const double* reference_point, double* contributions,
+                              unsigned maximize_mask = DEFAULT_MAXIMIZE_MASK);
+
     /**
-     * @brief Removes points that are dominated in objectives [k...n]
+     * @brief Calculates the volume dominated by one point and by none of the given points
+     * 
+     * The point itself must not be among values; the result is the hypervolume
+     * gained by adding it to them, or lost by removing it.
      * 
-     * @param points Vector of points to filter
-     * @param k Starting objective index
-     * @return Vector of non-dominated points
+     * @param point Objective values of the point
+     * @param values Objective values of the other points, num_points * num_objectives entries
+     * @param num_points Number of other points
+     * @param num_objectives Number of objectives
+     * @param reference_point The reference point, used as given
+     * @param maximize_mask Bit i set if objective i is maximized
+     * @return The exclusive contribution of the point
      */
-    static std::vector<Point> filterDominated(const std::vector<Point>& points, size_t k);
-    
+    static double contribution(const double* point, const double* values, size_t num_points,
+                               size_t num_objectives, const double* reference_point,
+                               unsigned maximize_mask = DEFAULT_MAXIMIZE_MASK);
+
+private:
     /**
-     * @brief Computes the exclusive hypervolume contribution of a point
+     * @brief Per-thread buffers reused by every calculation
      * 
-     * @param point The point for which to calculate the exclusive contribution
-     * @param other_points The set of other points
-     * @param reference_point The reference point
-     * @return The exclusive hypervolume contribution
+     * Inputs that are not already contiguous are flattened into values. The
+     * index arena holds the point span of every recursion level; both only grow,
+     * so after the first calls on fronts of a given size HSO does not allocate.
+     */
+    struct Workspace {
+        std::vector<double> values;          ///< Row-major objective values
+        std::vector<std::uint32_t> indices;  ///< Index spans, one region per recursion level
+        std::vector<std::array<double, 3>> limits; ///< Points clipped for the 3D sweeps
+        std::vector<double> oriented;        ///< Minimized copy of the points for contributions
+        std::vector<double> clipped;         ///< Limit set of the point whose contribution is measured
+    };
+
+    /**
+     * @brief Returns the calling thread's workspace
      */
-    static double exclusiveVolume(const Point& point, 
-                                 const std::vector<Point>& other_points,
-                                 const std::vector<double>& reference_point);
+    static Workspace& workspace();
+
+    /**
+     * @brief Validates the input and runs the kernel for its dimension
+     * 
+     * @param threads Threads for the slices of the first objective (1 = calling thread only)
+     */
+    static double measure(const double* values, size_t num_points, size_t num_objectives,
+                          const double* reference_point, unsigned maximize_mask, size_t threads);
+
+    /**
+     * @brief Flattens the objectives of the solutions into the workspace values
+     * 
+     * @return The reference point to measure them against: the given one, or one
+     *         derived from the solutions when the given one is rejected
+     */
+    static std::vector<double> flattenSolutions(const std::vector<Solution>& solutions,
+                                                const std::vector<double>& reference_point);
+
+    /**
+     * @brief Exclusive contribution of a minimized point against minimized members
+     * 
+     * @param bound The point
+     * @param points Row-major minimized points
+     * @param members Indices of the points to compare against
+     * @param count Number of members
+     * @param self Member to skip (the point itself, if it is among them)
+     * @param n Number of objectives
+     * @param reference Minimized reference point
+     * @return The point's box minus the volume of the members clipped to it
+     */
+    static double clippedContribution(const double* bound, const double* points,
+                                      const std::uint32_t* members, size_t count, std::uint32_t self,
+                                      size_t n, const double* reference);
 };
 
 /**
@@ -162,6 +266,8 @@ public:
     /**
      * @brief Calculates the hypervolume contribution of each solution
      * 
+     * Forwards to HypervolumeCalculator::contributions.
+     * 
      * @param solutions Vector of solutions
      * @param reference_point The reference point
      * @return Vector of hypervolume contributions, one for each solution
@@ -172,6 +278,8 @@ public:
     /**
      * @brief Calculates the exclusive hypervolume contribution of each solution
      * 
+     * Same values as calculateContributions: the volume lost when the solution is removed.
+     * 
      * @param solutions Vector of solutions
      * @param reference_point The reference point
      * @return Vector of exclusive hypervolume contributions, one for each solution
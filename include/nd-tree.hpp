@@ -0,0 +1,313 @@
+// File: include/nd-tree.hpp
+// Unbounded Pareto archive indexed by an ND-tree
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace tourist {
+
+/**
+ * @class NDTree
+ * @brief Set of mutually non-dominated points with sublinear dominance queries
+ *
+ * Follows the ND-tree of Jaszkiewicz & Lust (2018). Every node keeps an ideal
+ * and a nadir bound of the points below it, which lets an update decide for a
+ * whole subtree at once:
+ *  - if the nadir weakly dominates the new point, every point in the subtree does,
+ *    and the new point is rejected;
+ *  - if the new point weakly dominates the ideal, it dominates the whole subtree,
+ *    which is removed;
+ *  - if the point is neither dominated by the ideal nor dominating the nadir, no
+ *    point of the subtree can be compared with it and the subtree is skipped.
+ * New points descend to the child whose bounding box center is closest and leaves
+ * split into NUM_CHILDREN children once they exceed their capacity.
+ *
+ * All objectives are minimized. Bounds only grow on insertion and are not tightened
+ * after removals, which keeps them valid (if looser) bounds.
+ *
+ * @tparam Payload Data stored with each point
+ * @tparam Dim Number of objectives
+ */
+template <typename Payload, size_t Dim>
+class NDTree {
+public:
+    using Point = std::array<double, Dim>;
+
+    struct Entry {
+        Point point;
+        Payload payload;
+    };
+
+    static constexpr size_t NUM_CHILDREN = Dim + 1;
+
+    explicit NDTree(size_t max_leaf_size = 20) : max_leaf_size_(max_leaf_size) {
+        if (max_leaf_size_ < NUM_CHILDREN) {
+            throw std::invalid_argument("ND-tree leaves must hold at least one point per child");
+        }
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    void clear() {
+        root_.reset();
+        size_ = 0;
+    }
+
+    // Whether some archived point weakly dominates (or equals) the point
+    bool isCovered(const Point& point) const {
+        return root_ && covered(*root_, point);
+    }
+
+    // Adds the point unless it is weakly dominated; archived points it dominates are
+    // removed first and passed to on_remove. Returns whether the point was added.
+    template <typename OnRemove>
+    bool insert(const Point& point, const Payload& payload, OnRemove&& on_remove) {
+        if (root_) {
+            if (!update(*root_, point, on_remove)) return false;
+            if (isEmpty(*root_)) root_.reset();
+        }
+        if (!root_) {
+            root_ = std::make_unique<Node>(point);
+        }
+        descend(*root_, Entry{point, payload});
+        ++size_;
+        return true;
+    }
+
+    bool insert(const Point& point, const Payload& payload) {
+        return insert(point, payload, [](const Entry&) {});
+    }
+
+    // Visits every archived entry
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        if (root_) visitNode(*root_, visit);
+    }
+
+private:
+    struct Node {
+        explicit Node(const Point& point) : ideal(point), nadir(point) {}
+
+        Point ideal;                                // Component-wise lower bound
+        Point nadir;                                // Component-wise upper bound
+        std::vector<Entry> entries;                 // Points of a leaf
+        std::vector<std::unique_ptr<Node>> children; // Empty for leaves
+
+        bool isLeaf() const { return children.empty(); }
+    };
+
+    static bool weaklyDominates(const Point& a, const Point& b) {
+        for (size_t i = 0; i < Dim; ++i) {
+            if (a[i] > b[i]) return false;
+        }
+        return true;
+    }
+
+    static bool dominates(const Point& a, const Point& b) {
+        return weaklyDominates(a, b) && a != b;
+    }
+
+    static bool isEmpty(const Node& node) {
+        return node.isLeaf() && node.entries.empty();
+    }
+
+    static double distanceToCenter(const Node& node, const Point& point) {
+        double sum = 0.0;
+        for (size_t i = 0; i < Dim; ++i) {
+            double d = point[i] - 0.5 * (node.ideal[i] + node.nadir[i]);
+            sum += d * d;
+        }
+        return sum;
+    }
+
+    static void extend(Node& node, const Point& point) {
+        for (size_t i = 0; i < Dim; ++i) {
+            if (point[i] < node.ideal[i]) node.ideal[i] = point[i];
+            if (point[i] > node.nadir[i]) node.nadir[i] = point[i];
+        }
+    }
+
+    bool covered(const Node& node, const Point& point) const {
+        if (weaklyDominates(node.nadir, point)) return true;
+        if (!weaklyDominates(node.ideal, point)) return false;
+        if (node.isLeaf()) {
+            for (const auto& entry : node.entries) {
+                if (weaklyDominates(entry.point, point)) return true;
+            }
+            return false;
+        }
+        for (const auto& child : node.children) {
+            if (covered(*child, point)) return true;
+        }
+        return false;
+    }
+
+    // Returns false if the point is covered. Once a covered point is found no point
+    // has been removed: anything it dominated would be dominated by the covering point.
+    template <typename OnRemove>
+    bool update(Node& node, const Point& point, OnRemove& on_remove) {
+        if (weaklyDominates(node.nadir, point)) return false;
+        
+        if (weaklyDominates(point, node.ideal)) {
+            removeAll(node, on_remove);
+            return true;
+        }
+        
+        if (!weaklyDominates(node.ideal, point) && !weaklyDominates(point, node.nadir)) {
+            return true;
+        }
+        
+        if (node.isLeaf()) {
+            for (size_t i = 0; i < node.entries.size();) {
+                if (weaklyDominates(node.entries[i].point, point)) return false;
+                if (dominates(point, node.entries[i].point)) {
+                    on_remove(node.entries[i]);
+                    node.entries[i] = std::move(node.entries.back());
+                    node.entries.pop_back();
+                    --size_;
+                } else {
+                    ++i;
+                }
+            }
+            return true;
+        }
+        
+        for (size_t i = 0; i < node.children.size();) {
+            if (!update(*node.children[i], point, on_remove)) return false;
+            if (isEmpty(*node.children[i])) {
+                node.children.erase(node.children.begin() + i);
+            } else {
+                ++i;
+            }
+        }
+        
+        // A node left with a single child is replaced by that child
+        if (node.children.size() == 1) {
+            std::unique_ptr<Node> child = std::move(node.children.front());
+            node.children = std::move(child->children);
+            node.entries = std::move(child->entries);
+        }
+        return true;
+    }
+
+    template <typename OnRemove>
+    void removeAll(Node& node, OnRemove& on_remove) {
+        for (const auto& entry : node.entries) {
+            on_remove(entry);
+        }
+        size_ -= node.entries.size();
+        node.entries.clear();
+        for (auto& child : node.children) {
+            removeAll(*child, on_remove);
+        }
+        node.children.clear();
+    }
+
+    void descend(Node& root, Entry entry) {
+        Node* node = &root;
+        while (true) {
+            extend(*node, entry.point);
+            if (node->isLeaf()) break;
+            
+            Node* closest = node->children.front().get();
+            double best = distanceToCenter(*closest, entry.point);
+            for (size_t i = 1; i < node->children.size(); ++i) {
+                double d = distanceToCenter(*node->children[i], entry.point);
+                if (d < best) {
+                    best = d;
+                    closest = node->children[i].get();
+                }
+            }
+            node = closest;
+        }
+        
+        node->entries.push_back(std::move(entry));
+        if (node->entries.size() > max_leaf_size_) {
+            split(*node);
+        }
+    }
+
+    // Seeds NUM_CHILDREN children with mutually distant points, then places the
+    // remaining points in the child with the closest center
+    void split(Node& leaf) {
+        std::vector<Entry> entries = std::move(leaf.entries);
+        leaf.entries.clear();
+        
+        auto squaredDistance = [](const Point& a, const Point& b) {
+            double sum = 0.0;
+            for (size_t i = 0; i < Dim; ++i) sum += (a[i] - b[i]) * (a[i] - b[i]);
+            return sum;
+        };
+        
+        // First seed: largest average distance to all other points
+        size_t seed = 0;
+        double best = -1.0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            double total = 0.0;
+            for (size_t j = 0; j < entries.size(); ++j) total += squaredDistance(entries[i].point, entries[j].point);
+            if (total > best) {
+                best = total;
+                seed = i;
+            }
+        }
+        
+        std::vector<bool> used(entries.size(), false);
+        auto addChild = [&](size_t index) {
+            auto child = std::make_unique<Node>(entries[index].point);
+            child->entries.push_back(std::move(entries[index]));
+            leaf.children.push_back(std::move(child));
+            used[index] = true;
+        };
+        addChild(seed);
+        
+        // Further seeds: largest average distance to the seeds chosen so far
+        while (leaf.children.size() < NUM_CHILDREN) {
+            size_t next = entries.size();
+            best = -1.0;
+            for (size_t i = 0; i < entries.size(); ++i) {
+                if (used[i]) continue;
+                double total = 0.0;
+                for (const auto& child : leaf.children) total += squaredDistance(entries[i].point, child->ideal);
+                if (total > best) {
+                    best = total;
+                    next = i;
+                }
+            }
+            addChild(next);
+        }
+        
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (used[i]) continue;
+            Node* closest = leaf.children.front().get();
+            double closest_distance = distanceToCenter(*closest, entries[i].point);
+            for (size_t c = 1; c < leaf.children.size(); ++c) {
+                double d = distanceToCenter(*leaf.children[c], entries[i].point);
+                if (d < closest_distance) {
+                    closest_distance = d;
+                    closest = leaf.children[c].get();
+                }
+            }
+            extend(*closest, entries[i].point);
+            closest->entries.push_back(std::move(entries[i]));
+        }
+    }
+
+    template <typename Visitor>
+    static void visitNode(const Node& node, Visitor& visit) {
+        for (const auto& entry : node.entries) visit(entry);
+        for (const auto& child : node.children) visitNode(*child, visit);
+    }
+
+    std::unique_ptr<Node> root_;
+    size_t max_leaf_size_;
+    size_t size_{0};
+};
+
+} // namespace tourist
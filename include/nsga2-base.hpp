@@ -6,27 +6,83 @@
 
 #include "base.hpp"
 #include "models.hpp"
+#include "chromosome.hpp"
+#include "crowding.hpp"
+#include "fitness-cache.hpp"
+#include "telemetry.hpp"
+#include "checkpoint.hpp"
+#include "archive-stream.hpp"
+#include "nd-tree.hpp"
+#include "phase-profile.hpp"
+#include "hypervolume-tracker.hpp"
+#include <array>
 #include <vector>
 #include <memory>
 #include <random>
 #include <functional>
 #include <algorithm>
 #include <limits>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
 
 namespace tourist {
 
 // Forward declarations
 class Solution;
 class Route;
+struct NSGA2BaseTestAccess;
 
 class NSGA2Base final : public EvolutionaryAlgorithm {
 public:
     // Configuration parameters for NSGA-II
     struct Parameters {
+        // Population update scheme
+        enum class Mode {
+            GENERATIONAL,   // Replace the population each generation (Deb et al., 2002)
+            STEADY_STATE    // Insert a few offspring at a time with incremental front updates
+        };
+        
+        // Truncation of the last front that does not fit in the population
+        enum class Survival {
+            CROWDING,       // Keep the most widely spread members (Deb et al., 2002)
+            HYPERVOLUME     // Drop the least hypervolume contributor, one at a time (SMS-EMOA, Beume et al., 2007)
+        };
+
         size_t population_size;     // Size of population
         size_t max_generations;     // Maximum number of generations
         double crossover_rate;      // Probability of crossover
         double mutation_rate;       // Probability of mutation
+        Mode mode{Mode::GENERATIONAL};  // Population update scheme
+        size_t offspring_per_step{1};   // Offspring inserted per steady-state step
+        Survival survival{Survival::CROWDING}; // Truncation of the last accepted front
+        size_t fitness_cache_size{4096}; // Slots in the fitness memoization cache (0 disables)
+        bool deduplicate_offspring{true}; // Reject children identical to a parent or sibling
+        bool external_archive{true};    // Keep every non-dominated route found and return it from run()
+        
+        // Optional stopping criteria, checked after every generation (0 disables each one)
+        double hv_epsilon{0.0};         // Minimum relative hypervolume gain over hv_window generations
+        size_t hv_window{0};            // Sliding window for the hypervolume criterion
+        size_t stall_generations{0};    // Stop once the first front is unchanged this many generations
+        double time_budget_seconds{0.0}; // Wall-clock budget for run()
+        size_t max_evaluations{0};      // Budget of objective evaluations (cache hits are free)
+        
+        // Telemetry
+        TelemetryLevel telemetry_level{TelemetryLevel::GENERATION};   // Events emitted at run time
+        bool profile_phases{true};      // Time every phase of every generation
+        bool perf_counters{false};      // Hardware counters per phase (needs TOURIST_ENABLE_PERF_COUNTERS)
+        bool track_hypervolume{true};   // First-front hypervolume per generation (always on for the hv criterion)
+        std::string generations_file{"../results/nsga2-geracoes.csv"}; // Default CSV sink at GENERATION level (empty disables)
+        
+        // Checkpointing
+        std::string checkpoint_file;    // Binary checkpoint written during run() (empty disables)
+        size_t checkpoint_interval{10}; // Generations between checkpoints
+        bool resume{false};             // Continue from checkpoint_file when it exists, appending to the outputs
+        
+        // Live output of first-front changes
+        std::string archive_stream_file;        // NDJSON event stream of the archive (empty disables)
+        StreamFlushPolicy archive_stream_flush; // Buffering of the stream
 
         // Default constructor with reasonable values
         Parameters()
@@ -46,12 +102,48 @@ public:
         void validate() const;
     };
 
+    // Why run() stopped
+    enum class StopReason {
+        MAX_GENERATIONS,        // Completed max_generations
+        HYPERVOLUME_CONVERGED,  // Hypervolume gain over the window fell below hv_epsilon
+        FRONT_UNCHANGED,        // First front identical for stall_generations generations
+        TIME_BUDGET,            // time_budget_seconds exhausted
+        EVALUATION_BUDGET       // max_evaluations exhausted
+    };
+    
+    // Summary of the last run
+    struct RunInfo {
+        StopReason stop_reason{StopReason::MAX_GENERATIONS};
+        size_t generations{0};          // Generations completed
+        size_t evaluations{0};          // Objective evaluations performed
+        size_t archive_size{0};         // Routes in the external archive at the end
+        double elapsed_seconds{0.0};    // Wall-clock time of run()
+    };
+    
+    static const char* stopReasonName(StopReason reason);
+
 protected:
     // Individual representation for NSGA-II
     class Individual {
     public:
+        // Routes are limited to this many attractions
+        static constexpr size_t MAX_ROUTE_LENGTH = 8;
+        static constexpr size_t NUM_OBJECTIVES = 4;
+
+        using Chromosome = FixedChromosome<MAX_ROUTE_LENGTH>;
+        using TransportModes = std::array<utils::TransportMode, MAX_ROUTE_LENGTH - 1>;
+        using Objectives = std::array<double, NUM_OBJECTIVES>;
+        
+        // Objectives assigned to invalid or empty routes
+        static constexpr Objectives PENALTY_OBJECTIVES = {
+            1000.0,                                   // High cost penalty
+            double(utils::Config::DAILY_TIME_LIMIT),  // Excessive time penalty
+            -1.0,                                     // Few attractions penalty
+            -1.0                                      // Few neighborhoods penalty
+        };
+
         // Construct an individual from a sequence of attraction indices
-        explicit Individual(std::vector<int> attraction_indices);
+        explicit Individual(const Chromosome& chromosome);
         
         // Evaluate this individual against all objectives
         void evaluate(const NSGA2Base& algorithm);
@@ -59,23 +151,39 @@ protected:
         // Check if this individual dominates another
         bool dominates(const Individual& other) const;
         
+        // Invalid or empty routes receive PENALTY_OBJECTIVES
+        bool isFeasible() const { return objectives_ != PENALTY_OBJECTIVES; }
+        
         // Create a Route from this individual
         Route constructRoute(const NSGA2Base& algorithm) const;
         
+        // Everything evaluate() depends on: the sequence and the modes in use
+        struct EvaluationKey {
+            Chromosome chromosome;
+            TransportModes modes{};     // Unused entries are left as CAR
+            
+            bool operator==(const EvaluationKey& other) const {
+                return chromosome == other.chromosome && modes == other.modes;
+            }
+        };
+        EvaluationKey evaluationKey() const;
+        static std::uint64_t hashKey(const EvaluationKey& key);
+        
         // Getters and setters
         int getRank() const { return rank_; }
         double getCrowdingDistance() const { return crowding_distance_; }
-        const std::vector<double>& getObjectives() const { return objectives_; }
-        const std::vector<int>& getChromosome() const { return chromosome_; }
-        const std::vector<utils::TransportMode>& getTransportModes() const { return transport_modes_; }
+        const Objectives& getObjectives() const { return objectives_; }
+        const Chromosome& getChromosome() const { return chromosome_; }
+        // Only the first getChromosome().size() - 1 entries are meaningful
+        const TransportModes& getTransportModes() const { return transport_modes_; }
         
         void setRank(int rank) { rank_ = rank; }
         void setCrowdingDistance(double distance) { crowding_distance_ = distance; }
         
     private:
-        std::vector<int> chromosome_;                       // Indices of attractions in visit order
-        std::vector<utils::TransportMode> transport_modes_; // Transport mode between attractions
-        std::vector<double> objectives_;                    // Objective values [cost, time, -attractions]
+        Chromosome chromosome_;                             // Indices of attractions in visit order
+        TransportModes transport_modes_{};                  // Transport mode between attractions
+        Objectives objectives_{};                           // Objective values [cost, time, -attractions, -neighborhoods]
         int rank_{0};                                      // Non-domination rank (lower is better)
         double crowding_distance_{0.0};                     // Crowding distance for diversity
         
@@ -83,8 +191,13 @@ protected:
         void determineTransportModes(const NSGA2Base& algorithm);
         
         friend class NSGA2Base;  // Allow NSGA2Base to access private members
+        friend struct NSGA2BaseTestAccess;
     };
 
+    // Individuals hold no heap storage and can be copied bytewise
+    static_assert(std::is_trivially_copyable<Individual>::value,
+                  "Individual must stay trivially copyable");
+
 public:
     // Constructor
     NSGA2Base(const std::vector<Attraction>& attractions, Parameters params = Parameters());
@@ -97,6 +210,19 @@ public:
     
     // Run the algorithm and return non-dominated solutions
     std::vector<Solution> run() override;
+    
+    // Fitness memoization statistics of the last run
+    using FitnessCacheStats = FitnessCache<Individual::EvaluationKey, Individual::Objectives>::Stats;
+    const FitnessCacheStats& getFitnessCacheStats() const { return fitness_cache_.stats(); }
+    
+    // Stopping reason, generation count and evaluation count of the last run
+    const RunInfo& getRunInfo() const { return run_info_; }
+    
+    // Per-phase times of the last run: sample 0 covers initialization, sample g generation g
+    const PhaseProfile& getPhaseProfile() const { return profile_; }
+    
+    // Register a telemetry sink; without any, run() reports to stdout and generations_file
+    void addTelemetrySink(std::shared_ptr<TelemetrySink> sink);
 
 private:
     using IndividualPtr = std::shared_ptr<Individual>;
@@ -111,19 +237,59 @@ private:
     std::vector<Front> fastNonDominatedSort(const Population& pop) const;
     
     // Crowding distance assignment (Section III-B)
-    void calculateCrowdingDistances(Front& front) const;
+    void calculateCrowdingDistances(Front& front);
+    
+    // Compute crowding distances of a level of fronts_ on first use
+    void ensureCrowding(size_t level);
     
     // Main loop selection method (Section III-C)
     Population selectNextGeneration(const Population& parents, const Population& offspring);
     
+    // Steady-state update with incremental non-domination levels (ENLU, Li et al. 2016)
+    void steadyStateGeneration();
+    void insertIntoFronts(const IndividualPtr& ind);
+    void removeWorstFromFronts();
+    
+    // SMS-EMOA truncation of a front down to keep members; returns the removed ones
+    Front truncateByHypervolume(Front& front, size_t keep) const;
+    
     // Genetic operators
-    Population createOffspring(const Population& parents);
+    Population createOffspring(const Population& parents, size_t count);
     IndividualPtr tournamentSelection(const Population& pop);
     IndividualPtr crossover(const IndividualPtr& parent1, const IndividualPtr& parent2);
     void mutate(IndividualPtr individual);
     
+    // Stopping criteria
+    bool shouldStop(std::chrono::steady_clock::time_point start);
+    
+    // First-front hypervolume, updated with the members that entered or left the front and
+    // recomputed from scratch every HV_REFRESH_INTERVAL generations to drop accumulated rounding
+    bool hypervolumeTracked() const;
+    void trackFrontHypervolume();
+    static std::vector<double> hypervolumeReference();
+    
+    // Checkpointing: snapshots are taken here and written by a CheckpointWriter
+    CheckpointData makeCheckpoint() const;
+    bool restoreCheckpoint(std::vector<Individual>& archived);
+    std::uint64_t checkpointFingerprint() const;
+    
+    // External archive of every feasible non-dominated individual evaluated so far
+    void archiveInsert(const Individual& ind);
+    
+    // Feasible first-front members keyed by evaluation hash, sorted by key without repeats
+    std::vector<std::pair<std::uint64_t, const Individual*>> firstFrontMembers() const;
+    
+    // Without the external archive, the first front is streamed as a diff after each generation
+    void streamFrontChanges(ArchiveStream& stream);
+    ArchiveEntry makeArchiveEntry(const Individual& ind, std::uint64_t id) const;
+    
+    // Telemetry
+    PhaseProfile* profiler() { return params_.profile_phases ? &profile_ : nullptr; }
+    bool telemetryEnabled(TelemetryLevel level) const;
+    std::vector<std::shared_ptr<TelemetrySink>> activeSinks() const;
+    
     // Utility methods
-    void logProgress(size_t generation, const std::vector<Front>& fronts) const;
+    GenerationRecord summarizeGeneration(size_t generation, const Front& first_front) const;
     void createAttractionMapping();
     
     // Crowded comparison operator (Section III-B)
@@ -133,6 +299,33 @@ private:
     const std::vector<Attraction>& attractions_;
     const Parameters params_;
     Population population_;
+    std::vector<Front> fronts_;             // Non-domination levels of population_
+    std::vector<bool> crowding_valid_;      // Whether each level's crowding distances are current
+    CrowdingDistance crowding_;             // Reusable crowding distance engine
+    FitnessCache<Individual::EvaluationKey, Individual::Objectives> fitness_cache_;
+    
+    std::vector<std::shared_ptr<TelemetrySink>> sinks_;     // User-registered sinks
+    PhaseProfile profile_;                                  // Phase times of the current run
+    ChromosomeSet<Individual::Chromosome> offspring_seen_;  // Scratch set for offspring deduplication
+    
+    // Checks of the level maintenance in tests/ drive the private members directly
+    friend struct NSGA2BaseTestAccess;
+    
+    static constexpr size_t MAX_DUPLICATE_REJECTIONS_PER_CHILD = 10;
+    static constexpr size_t HV_REFRESH_INTERVAL = 10;   // Generations between exact first-front hypervolumes
+    
+    // Run bookkeeping for the stopping criteria
+    RunInfo run_info_;
+    std::vector<double> hv_history_;                // First-front hypervolume of the last hv_window + 1 generations
+    std::vector<std::uint64_t> front_signature_;    // Sorted distinct key hashes of the previous feasible first front
+    size_t unchanged_generations_{0};
+    std::vector<std::uint64_t> streamed_ids_;       // Sorted ids of the first front as last streamed
+    utils::HypervolumeTracker hv_tracker_{hypervolumeReference(), 0}; // Hypervolume of the first front
+    std::vector<std::uint64_t> tracked_ids_;        // Sorted ids of the first front as last tracked
+    
+    NDTree<Individual, Individual::NUM_OBJECTIVES> archive_;
+    ArchiveStream* archive_stream_{nullptr};        // Stream of the current run, if any
+    size_t stream_generation_{0};                   // Generation reported with archive events
     mutable std::mt19937 rng_{std::random_device{}()};
 };
 
@@ -0,0 +1,64 @@
+// File: include/perf-counters.hpp
+// Hardware performance counters read through perf_event_open (Linux)
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Counter support is compiled in only when requested (CMake option TOURIST_ENABLE_PERF_COUNTERS)
+#ifndef TOURIST_ENABLE_PERF_COUNTERS
+#define TOURIST_ENABLE_PERF_COUNTERS 0
+#endif
+
+namespace tourist {
+
+enum class Counter : std::uint8_t {
+    CYCLES,
+    INSTRUCTIONS,
+    LLC_MISSES,         // Last-level cache misses
+    BRANCH_MISSES,
+    COUNT
+};
+
+constexpr size_t NUM_COUNTERS = static_cast<size_t>(Counter::COUNT);
+constexpr bool PERF_COUNTERS_COMPILED = TOURIST_ENABLE_PERF_COUNTERS != 0;
+
+using CounterValues = std::array<std::uint64_t, NUM_COUNTERS>;
+
+const char* counterName(Counter counter);
+
+/**
+ * @class PerfCounters
+ * @brief Group of user-space hardware counters for the calling thread
+ *
+ * All counters are opened as one perf event group so they are scheduled together.
+ * Counters the CPU or the kernel does not provide are left out and read as zero;
+ * if none can be opened (no PMU, perf_event_paranoid, seccomp, or support compiled
+ * out) the object is unavailable and error() tells why. Values are scaled by
+ * enabled/running time when the kernel multiplexes the group.
+ */
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return group_fd_ >= 0; }
+    bool supported(Counter counter) const { return fds_[static_cast<size_t>(counter)] >= 0; }
+    const std::string& error() const { return error_; }
+
+    // Cumulative counts since the group was opened; returns false if unavailable
+    bool read(CounterValues& values) const;
+
+private:
+    std::array<int, NUM_COUNTERS> fds_;
+    int group_fd_{-1};
+    std::string error_;
+};
+
+} // namespace tourist
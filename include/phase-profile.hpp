@@ -0,0 +1,164 @@
+// File: include/phase-profile.hpp
+// Per-phase wall-clock profile of the optimizer's generation loop
+
+#pragma once
+
+#include "perf-counters.hpp"
+#include "allocation-tracker.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tourist {
+
+// Phases of a generation; time spent in a nested phase is not charged to the enclosing one
+enum class Phase : std::uint8_t {
+    INITIALIZATION,     // Random population or checkpoint restore
+    OFFSPRING,          // Tournament selection, crossover and mutation
+    EVALUATION,         // Objective evaluation and fitness cache
+    ARCHIVE,            // External archive updates
+    SORTING,            // Non-dominated sorting (or incremental level updates)
+    CROWDING,           // Crowding distances
+    SELECTION,          // Environmental selection
+    STOPPING,           // Stopping criteria
+    LOGGING,            // Telemetry, archive stream and checkpoints
+    COUNT
+};
+
+constexpr size_t NUM_PHASES = static_cast<size_t>(Phase::COUNT);
+
+const char* phaseName(Phase phase);
+
+/**
+ * @class PhaseProfile
+ * @brief Exclusive time per phase, recorded once per generation
+ *
+ * Phases are entered and left through ScopedPhase. Entering a phase pauses the
+ * active one, so nested phases (evaluation inside offspring creation, crowding
+ * inside selection) are charged only to the innermost phase. endGeneration()
+ * closes a sample: every phase entered since the previous sample contributes
+ * its accumulated time to its distribution.
+ *
+ * With hardware counters enabled, the counter group is read at the same points
+ * as the clock, so every phase also accumulates exclusive cycles, instructions,
+ * LLC misses and branch misses per sample. Counters follow the thread that
+ * enabled them.
+ *
+ * In builds with TOURIST_TRACK_ALLOCATIONS, heap allocations are attributed to
+ * phases the same way, and every sample also records the allocations of the
+ * whole generation (any thread, inside a phase or not) and the peak RSS.
+ */
+class PhaseProfile {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Distribution of one phase over the generations in which it ran (seconds)
+    struct Stats {
+        size_t samples{0};
+        double total{0.0};
+        double min{0.0};
+        double median{0.0};
+        double p99{0.0};
+        double max{0.0};
+        double mean{0.0};
+    };
+
+    // Starts timing phase and returns the phase that was active before
+    Phase enter(Phase phase);
+
+    // Stops timing the active phase and resumes previous
+    void leave(Phase previous);
+
+    // Closes the current generation's sample
+    void endGeneration();
+
+    // Clears the samples; counters stay enabled
+    void clear();
+
+    // Opens the hardware counters; returns false (leaving them off) if they are unavailable
+    bool enableCounters();
+    bool countersEnabled() const { return counters_ != nullptr; }
+    const std::string& countersError() const { return counters_error_; }
+
+    // Allocation accounting (all zero unless TOURIST_TRACK_ALLOCATIONS is compiled in)
+    static constexpr bool allocationsTracked() { return ALLOCATION_TRACKING_COMPILED; }
+    AllocationCounts allocationTotals(Phase phase) const;
+    const AllocationCounts& phaseAllocations(size_t generation, Phase phase) const {
+        return allocation_rows_[generation][static_cast<size_t>(phase)];
+    }
+    const AllocationCounts& generationAllocations(size_t generation) const {
+        return generation_allocations_[generation];
+    }
+    std::uint64_t peakResident(size_t generation) const { return peak_resident_[generation]; }
+
+    // Counter totals of a phase over all samples, and its counts in one sample
+    CounterValues counterTotals(Phase phase) const;
+    const CounterValues& generationCounters(size_t generation, Phase phase) const {
+        return counter_rows_[generation][static_cast<size_t>(phase)];
+    }
+
+    // Recorded samples (one per endGeneration call)
+    size_t samples() const { return generations_.size(); }
+    Stats stats(Phase phase) const;
+
+    // Nanoseconds spent in a phase during a recorded generation
+    std::int64_t generationTime(size_t generation, Phase phase) const {
+        return generations_[generation][static_cast<size_t>(phase)];
+    }
+
+    // JSON report with the per-phase statistics and the raw per-generation times;
+    // throws std::runtime_error if the file cannot be written
+    void writeReport(const std::string& filename) const;
+
+private:
+    using Row = std::array<std::int64_t, NUM_PHASES>;   // Nanoseconds, -1 when the phase did not run
+    using CounterRow = std::array<CounterValues, NUM_PHASES>;
+    using AllocationRow = std::array<AllocationCounts, NUM_PHASES>;
+
+    // Charges the time (and counts) since the last transition to the active phase
+    void charge(Clock::time_point now);
+
+    Row current_{};
+    std::array<bool, NUM_PHASES> entered_{};
+    std::vector<Row> generations_;
+    Phase active_{Phase::COUNT};
+    Clock::time_point started_;
+
+    std::unique_ptr<PerfCounters> counters_;   // Null unless enableCounters() succeeded
+    std::string counters_error_;
+    CounterValues last_counts_{};
+    CounterRow current_counts_{};
+    std::vector<CounterRow> counter_rows_;
+
+    AllocationCounts last_allocations_{};
+    AllocationCounts generation_start_{};
+    AllocationRow current_allocations_{};
+    std::vector<AllocationRow> allocation_rows_;
+    std::vector<AllocationCounts> generation_allocations_;
+    std::vector<std::uint64_t> peak_resident_;      // Bytes at the end of each sample
+};
+
+// Times a scope as the given phase; a null profile disables timing
+class ScopedPhase {
+public:
+    ScopedPhase(PhaseProfile* profile, Phase phase)
+        : profile_(profile)
+        , previous_(profile ? profile->enter(phase) : Phase::COUNT) {}
+
+    ~ScopedPhase() {
+        if (profile_) profile_->leave(previous_);
+    }
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+private:
+    PhaseProfile* profile_;
+    Phase previous_;
+};
+
+} // namespace tourist
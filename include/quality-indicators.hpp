@@ -0,0 +1,157 @@
+// File: include/quality-indicators.hpp
+// Distance, epsilon, spread and coverage indicators of approximation fronts
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tourist {
+namespace utils {
+
+/**
+ * @class ObjectiveSet
+ * @brief Objective vectors stored one column per objective
+ *
+ * Every objective is minimized. The indicator kernels run down the columns in
+ * blocks, one objective at a time, with branch-free loops the compiler
+ * vectorizes.
+ */
+class ObjectiveSet {
+public:
+    explicit ObjectiveSet(size_t num_objectives = 0) : columns_(num_objectives) {}
+
+    // Set of points stored row-major, values[i * num_objectives + j] being objective j of point i
+    static ObjectiveSet fromRows(const double* values, size_t num_points, size_t num_objectives);
+
+    size_t dimensions() const { return columns_.size(); }
+    size_t size() const { return columns_.empty() ? 0 : columns_[0].size(); }
+    bool empty() const { return size() == 0; }
+
+    const double* column(size_t objective) const { return columns_[objective].data(); }
+    double value(size_t point, size_t objective) const { return columns_[objective][point]; }
+
+    void reserve(size_t num_points);
+    void add(const double* point);
+
+private:
+    std::vector<std::vector<double>> columns_;
+};
+
+/**
+ * @class ReferenceIndex
+ * @brief k-d tree over a reference front for nearest-point queries
+ *
+ * Built once per reference front, it answers nearest-point queries in about
+ * logarithmic time instead of scanning the front. Leaves keep their points as
+ * contiguous columns and are scanned by the same kernels as a plain set.
+ */
+class ReferenceIndex {
+public:
+    explicit ReferenceIndex(const ObjectiveSet& reference);
+
+    size_t size() const { return points_.size(); }
+    size_t dimensions() const { return points_.dimensions(); }
+
+    /**
+     * @brief Nearest reference point to a query (Euclidean distance)
+     *
+     * @param query Objective values, dimensions() entries
+     * @param distance If not null, receives the distance to the nearest point
+     * @return Index of the nearest point in the reference front the index was built from
+     */
+    size_t nearest(const double* query, double* distance = nullptr) const;
+
+private:
+    struct Node {
+        size_t begin{0};     // Points [begin, end) of the reordered set
+        size_t end{0};
+        size_t objective{0}; // Splitting objective of an inner node
+        double split{0.0};   // Points of left are no greater, points of right no smaller
+        size_t left{0};      // Children (0 for a leaf: the root is never a child)
+        size_t right{0};
+    };
+
+    size_t build(const ObjectiveSet& reference, std::vector<std::uint32_t>& order, size_t begin, size_t end);
+    void search(size_t node, const double* query, size_t& best, double& best_squared) const;
+
+    ObjectiveSet points_;                // Reference points in tree order
+    std::vector<std::uint32_t> origin_;  // Index in the original front of each point
+    std::vector<Node> nodes_;
+};
+
+// All indicators of one front against a reference front
+struct IndicatorValues {
+    double gd{0.0};                      // Generational distance
+    double igd{0.0};                     // Inverted generational distance
+    double igd_plus{0.0};                // IGD+
+    double epsilon_additive{0.0};        // Additive epsilon indicator
+    double epsilon_multiplicative{0.0};  // Multiplicative epsilon indicator (NaN unless every value is positive)
+    double spread{0.0};                  // Deb's spread
+};
+
+/**
+ * @class QualityIndicators
+ * @brief Unary and binary quality indicators of minimized fronts
+ *
+ * Distance-based indicators are measured from a front A to a reference front R
+ * (ideally the Pareto front, in practice the merged front of all runs); lower
+ * is better for all of them. They are infinite when A or R is empty. Both sets
+ * must have the same number of objectives (std::invalid_argument otherwise).
+ */
+class QualityIndicators {
+public:
+    // GD: mean distance from each point of A to its nearest point of R (Van Veldhuizen, 1999)
+    static double generationalDistance(const ObjectiveSet& front, const ObjectiveSet& reference);
+
+    // GD with the nearest points found through an index of R
+    static double generationalDistance(const ObjectiveSet& front, const ReferenceIndex& reference);
+
+    // IGD: mean distance from each point of R to its nearest point of A (Coello and Cortés, 2005)
+    static double invertedGenerationalDistance(const ObjectiveSet& front, const ObjectiveSet& reference);
+
+    /**
+     * @brief IGD+: IGD with only the objectives in which A is worse counted (Ishibuchi et al., 2015)
+     *
+     * d+(r, a) = sqrt(sum of max(a_i - r_i, 0)^2), which keeps the indicator
+     * weakly Pareto compliant.
+     */
+    static double invertedGenerationalDistancePlus(const ObjectiveSet& front, const ObjectiveSet& reference);
+
+    // Smallest amount that, added to every objective of A, makes A weakly dominate R (Zitzler et al., 2003)
+    static double additiveEpsilon(const ObjectiveSet& front, const ObjectiveSet& reference);
+
+    /**
+     * @brief Smallest factor that, multiplying every objective of A, makes A weakly dominate R
+     *
+     * @throws std::invalid_argument unless every value of both sets is positive
+     */
+    static double multiplicativeEpsilon(const ObjectiveSet& front, const ObjectiveSet& reference);
+
+    /**
+     * @brief Deb's spread Δ (Deb et al., 2002), 0 for a uniform front that reaches the extremes
+     *
+     * With two objectives, the distances between consecutive points of A sorted
+     * by the first objective, plus the distances from the ends of A to the
+     * extreme points of R. With more, the generalization of Zhou et al. (2006):
+     * each point's distance to its nearest neighbor in A, plus the distance from
+     * each extreme point of R (best in one objective) to A. An empty R takes its
+     * extremes from A.
+     */
+    static double spread(const ObjectiveSet& front, const ObjectiveSet& reference);
+
+    // C(A, B): fraction of the points of B weakly dominated by some point of A; 0 when either is empty
+    static double coverage(const ObjectiveSet& a, const ObjectiveSet& b);
+
+    /**
+     * @brief All the unary indicators of a front against a reference front
+     *
+     * @param index Index of the reference front, used for GD when given
+     */
+    static IndicatorValues evaluate(const ObjectiveSet& front, const ObjectiveSet& reference,
+                                    const ReferenceIndex* index = nullptr);
+};
+
+} // namespace utils
+} // namespace tourist
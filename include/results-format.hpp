@@ -0,0 +1,97 @@
+// File: include/results-format.hpp
+// Compact columnar binary format for optimization results
+
+#pragma once
+
+#include "utils.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tourist {
+
+class Solution;
+
+/**
+ * @struct ResultsTable
+ * @brief Solutions stored column by column
+ *
+ * Per-solution values are plain columns of length size(). Stops and visited
+ * neighborhoods are variable-length lists stored as one flat column plus an
+ * offsets column of length size() + 1: the stops of solution i are the entries
+ * [stop_offsets[i], stop_offsets[i + 1]). Each stop records the mode used to
+ * reach it; the first stop of a route has none (NO_MODE).
+ * Names of attractions and neighborhoods are ids into a shared dictionary.
+ */
+struct ResultsTable {
+    static constexpr std::uint8_t NO_MODE = 0xFF;  // Arrival mode of a route's first stop
+
+    std::vector<std::string> dictionary;            // Attraction and neighborhood names
+
+    // One entry per solution
+    std::vector<double> cost;                       // Total cost (R$)
+    std::vector<double> time;                       // Total time objective (minutes)
+    std::vector<double> start_time;                 // Start of the day (minutes after midnight)
+    std::vector<double> end_time;                   // End of the route (minutes after midnight)
+    std::vector<std::uint16_t> attractions;         // Number of attractions
+    std::vector<std::uint16_t> neighborhoods;       // Number of distinct neighborhoods
+
+    // Stops of every solution, back to back
+    std::vector<std::uint32_t> stop_offsets;        // size() + 1 entries
+    std::vector<std::uint16_t> stop_names;          // Dictionary ids
+    std::vector<double> arrival_times;              // Minutes after midnight
+    std::vector<double> departure_times;            // Minutes after midnight
+    std::vector<std::uint8_t> arrival_modes;        // utils::TransportMode used to reach the stop
+
+    // Visited neighborhoods of every solution, back to back
+    std::vector<std::uint32_t> neighborhood_offsets; // size() + 1 entries
+    std::vector<std::uint16_t> neighborhood_names;   // Dictionary ids
+
+    size_t size() const { return cost.size(); }
+
+    // Builds the table from final solutions; routes start at day_start minutes after midnight
+    static ResultsTable fromSolutions(const std::vector<Solution>& solutions, double day_start = 9 * 60);
+};
+
+/**
+ * @class ResultsFormat
+ * @brief Reader and writer of the columnar results file (.bin)
+ *
+ * All integers and floats are little-endian; floats are IEEE-754 binary64.
+ * The file is a header followed by the dictionary and the columns, in this order:
+ *
+ *   Header (32 bytes)
+ *     char[8]  magic "TRRSLT01"
+ *     u32      format version (2)
+ *     u32      solution count n
+ *     u32      stop count s (sum of stops over all solutions)
+ *     u32      neighborhood reference count b
+ *     u32      dictionary entry count d
+ *     u32      reserved (0)
+ *   Dictionary
+ *     d times: u32 byte length, UTF-8 bytes (no terminator)
+ *   Columns, each starting at an offset that is a multiple of 8 (zero padding)
+ *     f64[n] cost, f64[n] time, f64[n] start_time, f64[n] end_time
+ *     u16[n] attractions, u16[n] neighborhoods
+ *     u32[n + 1] stop_offsets, u16[s] stop_names
+ *     f64[s] arrival_times, f64[s] departure_times
+ *     u8[s] arrival_modes (0 = walk, 1 = car, 255 = first stop of a route)
+ *     u32[n + 1] neighborhood_offsets, u16[b] neighborhood_names
+ *   Trailer, at an offset that is a multiple of 8
+ *     u64      FNV-1a checksum of all preceding bytes
+ *
+ * The alignment lets readers map columns directly, e.g. with numpy.frombuffer.
+ */
+class ResultsFormat {
+public:
+    // Throws std::runtime_error if the file cannot be written
+    static void write(const ResultsTable& table, const std::string& filename);
+
+    // Throws std::runtime_error if the file cannot be read, is malformed or fails its checksum
+    static ResultsTable read(const std::string& filename);
+
+    // Writes the table in the nsga2-resultados.csv layout
+    static void writeCsv(const ResultsTable& table, const std::string& filename);
+};
+
+} // namespace tourist
@@ -0,0 +1,180 @@
+// File: include/telemetry.hpp
+// Per-generation telemetry published through a lock-free ring to pluggable sinks
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Highest telemetry level compiled in (0 = off, 1 = summary, 2 = generation)
+#ifndef TOURIST_TELEMETRY_LEVEL
+#define TOURIST_TELEMETRY_LEVEL 2
+#endif
+
+namespace tourist {
+
+// Amount of telemetry emitted by the optimizer
+enum class TelemetryLevel : int {
+    OFF = 0,          // No events
+    SUMMARY = 1,      // Run start and end only
+    GENERATION = 2    // One record per generation as well
+};
+
+// Levels above this one are removed at compile time
+constexpr TelemetryLevel COMPILED_TELEMETRY_LEVEL = static_cast<TelemetryLevel>(TOURIST_TELEMETRY_LEVEL);
+
+// True if events of the given level can be emitted at all in this build
+constexpr bool telemetryCompiled(TelemetryLevel level) {
+    return level != TelemetryLevel::OFF &&
+           static_cast<int>(level) <= static_cast<int>(COMPILED_TELEMETRY_LEVEL);
+}
+
+// Compact summary of a generation's first front
+struct GenerationRecord {
+    std::uint32_t generation{0};
+    std::uint32_t front_size{0};
+    std::uint32_t max_attractions{0};
+    std::uint32_t max_neighborhoods{0};
+    double best_cost{0.0};
+    double best_time{0.0};
+    double hypervolume{0.0};    // Hypervolume of the first front (0 when not tracked)
+    bool has_feasible{false};   // Whether any first-front member is a valid route
+};
+
+// Outcome of a run, reported once it has finished
+struct RunSummary {
+    std::uint32_t generations{0};   // Generations completed
+    std::uint64_t evaluations{0};   // Objective evaluations performed
+    double elapsed_seconds{0.0};    // Wall-clock time
+    const char* stop_reason{""};    // Why the run stopped
+    bool stopped_early{false};      // Whether a stopping criterion ended the run
+};
+
+/**
+ * @class TelemetrySink
+ * @brief Receiver of optimizer events
+ *
+ * onRunStart and onRunEnd are called on the optimizer thread. onGeneration and
+ * flush are called on the telemetry thread: a batch of onGeneration calls is
+ * followed by one flush, so sinks can buffer their output and write it at once.
+ * A run resumed from a checkpoint starts with resuming set, so sinks extend the
+ * output of the interrupted run instead of replacing it.
+ */
+class TelemetrySink {
+public:
+    virtual ~TelemetrySink() = default;
+
+    virtual void onRunStart(bool resuming) { (void)resuming; }
+    virtual void onGeneration(const GenerationRecord& record) { (void)record; }
+    virtual void flush() {}
+    virtual void onRunEnd(const RunSummary& summary) { (void)summary; }
+};
+
+// Progress lines on std::cout
+class ConsoleSink : public TelemetrySink {
+public:
+    void onGeneration(const GenerationRecord& record) override;
+    void flush() override;
+    void onRunEnd(const RunSummary& summary) override;
+
+private:
+    std::string buffer_;
+};
+
+// Generations CSV (Generation;Front size;Best Cost;Best Time;Max Attractions;Hypervolume)
+class CsvSink : public TelemetrySink {
+public:
+    explicit CsvSink(std::string path) : path_(std::move(path)) {}
+
+    // Appends to an existing file without a new header when resuming
+    void onRunStart(bool resuming) override;
+    void onGeneration(const GenerationRecord& record) override;
+    void flush() override;
+    void onRunEnd(const RunSummary& summary) override;
+
+private:
+    std::string path_;
+    std::ofstream file_;
+    std::string buffer_;
+};
+
+/**
+ * @class SpscRing
+ * @brief Bounded single-producer single-consumer ring buffer without locks
+ *
+ * The producer only writes tail_ and the consumer only writes head_, so each
+ * side needs one acquire load and one release store per operation.
+ *
+ * @tparam T Trivially copyable element
+ * @tparam Capacity Number of slots (power of two)
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    // Producer side: returns false if the ring is full
+    bool push(const T& item) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Capacity) return false;
+        slots_[tail & (Capacity - 1)] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: returns false if the ring is empty
+    bool pop(T& item) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) return false;
+        item = slots_[head & (Capacity - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+    std::array<T, Capacity> slots_{};
+};
+
+/**
+ * @class TelemetryWriter
+ * @brief Delivers generation records to sinks on a background thread
+ *
+ * The optimizer publishes records into a ring; the writer thread drains it and
+ * hands each batch to every sink, followed by a flush.
+ */
+class TelemetryWriter {
+public:
+    explicit TelemetryWriter(std::vector<std::shared_ptr<TelemetrySink>> sinks);
+    ~TelemetryWriter();
+
+    TelemetryWriter(const TelemetryWriter&) = delete;
+    TelemetryWriter& operator=(const TelemetryWriter&) = delete;
+
+    // Hands a record to the writer thread; waits only if the ring is full
+    void publish(const GenerationRecord& record);
+
+    // Drains pending records and stops the thread
+    void close();
+
+private:
+    static constexpr size_t RING_CAPACITY = 1024;
+
+    void consume();
+    void drain();
+
+    SpscRing<GenerationRecord, RING_CAPACITY> ring_;
+    std::vector<std::shared_ptr<TelemetrySink>> sinks_;
+    std::atomic<bool> stop_{false};
+    std::thread thread_;
+};
+
+} // namespace tourist
@@ -0,0 +1,67 @@
+// File: include/thread-pool.hpp
+// Fixed set of worker threads that run indexed tasks in rounds
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tourist {
+namespace utils {
+
+/**
+ * @class ThreadPool
+ * @brief Threads that share the indexed tasks of a round
+ *
+ * Workers claim the next index from a shared counter, so tasks of very
+ * different cost balance themselves; the calling thread works as worker 0.
+ * Threads live as long as the pool, so scratch buffers indexed by worker can be
+ * reused across rounds. The first exception thrown by a task is rethrown by
+ * run() once every worker has finished the round.
+ */
+class ThreadPool {
+public:
+    // Threads to use, the calling one included (0 = hardware concurrency)
+    explicit ThreadPool(size_t threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return threads_.size() + 1; }
+
+    // Calls task(index, worker) for every index below count and returns once all are done
+    void run(size_t count, const std::function<void(size_t, size_t)>& task);
+
+    // Calls task(index) for every index below count on a pool of up to threads
+    // threads (0 = hardware concurrency), never more than count
+    static void parallelFor(size_t count, size_t threads, const std::function<void(size_t)>& task);
+
+    // Threads meant by a request for threads threads (0 = hardware concurrency)
+    static size_t resolve(size_t threads);
+
+private:
+    void drain(size_t worker);
+    void work(size_t worker);
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(size_t, size_t)>* task_{nullptr};
+    size_t count_{0};
+    std::atomic<size_t> next_{0};
+    size_t busy_{0};
+    size_t round_{0};
+    bool stopping_{false};
+    std::exception_ptr error_;
+};
+
+} // namespace utils
+} // namespace tourist
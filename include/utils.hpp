@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <cstdint>
 #include <unordered_map>
 
 namespace tourist {
@@ -14,7 +15,7 @@ class Solution;
 namespace utils {
 
 // Enumeração para modos de transporte
-enum class TransportMode {
+enum class TransportMode : std::uint8_t {
     WALK,
     CAR
 };
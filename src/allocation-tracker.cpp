@@ -0,0 +1,116 @@
+// File: src/allocation-tracker.cpp
+// With TOURIST_TRACK_ALLOCATIONS this file replaces the global allocation functions.
+// Linking any program that calls allocationCounts() pulls the replacements in.
+
+#include "allocation-tracker.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace tourist {
+
+namespace {
+
+std::atomic<std::uint64_t> g_allocations{0};
+std::atomic<std::uint64_t> g_deallocations{0};
+std::atomic<std::uint64_t> g_bytes{0};
+
+} // namespace
+
+AllocationCounts allocationCounts() {
+    AllocationCounts counts;
+    counts.allocations = g_allocations.load(std::memory_order_relaxed);
+    counts.deallocations = g_deallocations.load(std::memory_order_relaxed);
+    counts.bytes = g_bytes.load(std::memory_order_relaxed);
+    return counts;
+}
+
+std::uint64_t peakResidentBytes() {
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return static_cast<std::uint64_t>(usage.ru_maxrss);          // Bytes on macOS
+#else
+    return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;   // Kilobytes on Linux
+#endif
+#else
+    return 0;
+#endif
+}
+
+} // namespace tourist
+
+#if TOURIST_TRACK_ALLOCATIONS
+
+namespace {
+
+void* trackedAllocate(std::size_t size, std::size_t alignment) {
+    if (size == 0) size = 1;
+    
+    void* ptr = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+        ptr = std::malloc(size);
+    } else if (posix_memalign(&ptr, alignment, size) != 0) {
+        ptr = nullptr;
+    }
+    
+    if (ptr) {
+        tourist::g_allocations.fetch_add(1, std::memory_order_relaxed);
+        tourist::g_bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+    return ptr;
+}
+
+void* allocateOrThrow(std::size_t size, std::size_t alignment) {
+    while (true) {
+        if (void* ptr = trackedAllocate(size, alignment)) return ptr;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void trackedFree(void* ptr) noexcept {
+    if (!ptr) return;
+    tourist::g_deallocations.fetch_add(1, std::memory_order_relaxed);
+    std::free(ptr);
+}
+
+constexpr std::size_t DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+} // namespace
+
+void* operator new(std::size_t size) { return allocateOrThrow(size, DEFAULT_ALIGNMENT); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size, DEFAULT_ALIGNMENT); }
+void* operator new(std::size_t size, std::align_val_t al) { return allocateOrThrow(size, static_cast<std::size_t>(al)); }
+void* operator new[](std::size_t size, std::align_val_t al) { return allocateOrThrow(size, static_cast<std::size_t>(al)); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return trackedAllocate(size, DEFAULT_ALIGNMENT); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return trackedAllocate(size, DEFAULT_ALIGNMENT); }
+void* operator new(std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return trackedAllocate(size, static_cast<std::size_t>(al));
+}
+void* operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return trackedAllocate(size, static_cast<std::size_t>(al));
+}
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+
+#endif
@@ -0,0 +1,151 @@
+// File: src/archive-stream.cpp
+
+#include "archive-stream.hpp"
+#include <cstdio>
+#include <stdexcept>
+
+namespace tourist {
+
+ArchiveStream::ArchiveStream(std::string path, std::vector<std::string> poi_names, StreamFlushPolicy policy)
+    : path_(std::move(path))
+    , poi_names_(std::move(poi_names))
+    , policy_(policy) {}
+
+ArchiveStream::~ArchiveStream() {
+    if (file_.is_open()) {
+        flush();
+    }
+}
+
+void ArchiveStream::open() {
+    openFile(std::ios::out | std::ios::trunc);
+    append("{\"event\":\"run_start\"}");
+    flush();
+}
+
+void ArchiveStream::resume(size_t generation) {
+    openFile(std::ios::out | std::ios::app);
+    append("{\"event\":\"run_resume\",\"generation\":" + std::to_string(generation) + "}");
+    flush();
+}
+
+void ArchiveStream::openFile(std::ios::openmode mode) {
+    file_.open(path_, mode);
+    if (!file_.is_open()) {
+        throw std::runtime_error("Could not open archive stream: " + path_);
+    }
+    buffer_.reserve(policy_.max_bytes + 1024);
+    last_flush_ = std::chrono::steady_clock::now();
+}
+
+void ArchiveStream::insert(size_t generation, const ArchiveEntry& entry) {
+    char number[64];
+    
+    line_ = "{\"event\":\"insert\",\"generation\":";
+    line_ += std::to_string(generation);
+    line_ += ",\"id\":";
+    appendId(entry.id);
+    std::snprintf(number, sizeof(number), ",\"cost\":%.10g,\"time\":%.10g", entry.cost, entry.time);
+    line_ += number;
+    line_ += ",\"attractions\":" + std::to_string(entry.attractions);
+    line_ += ",\"neighborhoods\":" + std::to_string(entry.neighborhoods);
+    
+    line_ += ",\"sequence\":[";
+    for (size_t i = 0; i < entry.sequence.size(); ++i) {
+        if (i > 0) line_ += ',';
+        const int index = entry.sequence[i];
+        if (index >= 0 && static_cast<size_t>(index) < poi_names_.size()) {
+            appendString(poi_names_[index]);
+        } else {
+            line_ += std::to_string(index);
+        }
+    }
+    
+    line_ += "],\"modes\":[";
+    for (size_t i = 0; i < entry.modes.size(); ++i) {
+        if (i > 0) line_ += ',';
+        line_ += entry.modes[i] == utils::TransportMode::WALK ? "\"walk\"" : "\"car\"";
+    }
+    line_ += "]}";
+    
+    append(line_);
+}
+
+void ArchiveStream::remove(size_t generation, std::uint64_t id) {
+    line_ = "{\"event\":\"remove\",\"generation\":";
+    line_ += std::to_string(generation);
+    line_ += ",\"id\":";
+    appendId(id);
+    line_ += '}';
+    
+    append(line_);
+}
+
+void ArchiveStream::endGeneration() {
+    if (buffer_.empty()) return;
+    
+    const double since_flush = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - last_flush_).count();
+    if (since_flush >= policy_.max_interval_seconds) {
+        flush();
+    }
+}
+
+void ArchiveStream::close(size_t generations) {
+    if (!file_.is_open()) return;
+    
+    append("{\"event\":\"run_end\",\"generations\":" + std::to_string(generations) + "}");
+    flush();
+    file_.close();
+}
+
+void ArchiveStream::flush() {
+    last_flush_ = std::chrono::steady_clock::now();
+    if (buffer_.empty() || !file_.is_open()) return;
+    
+    file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    file_.flush();
+    buffer_.clear();
+    buffered_events_ = 0;
+}
+
+void ArchiveStream::append(const std::string& line) {
+    buffer_ += line;
+    buffer_ += '\n';
+    ++buffered_events_;
+    
+    if (buffered_events_ >= policy_.max_events || buffer_.size() >= policy_.max_bytes) {
+        flush();
+    }
+}
+
+// Ids are written as strings: 64-bit integers do not survive JSON parsers that use doubles
+void ArchiveStream::appendId(std::uint64_t id) {
+    char hex[20];
+    std::snprintf(hex, sizeof(hex), "\"%016llx\"", static_cast<unsigned long long>(id));
+    line_ += hex;
+}
+
+void ArchiveStream::appendString(const std::string& value) {
+    line_ += '"';
+    for (char c : value) {
+        switch (c) {
+            case '"':  line_ += "\\\""; break;
+            case '\\': line_ += "\\\\"; break;
+            case '\n': line_ += "\\n"; break;
+            case '\r': line_ += "\\r"; break;
+            case '\t': line_ += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    line_ += escaped;
+                } else {
+                    line_ += c;
+                }
+        }
+    }
+    line_ += '"';
+}
+
+} // namespace tourist
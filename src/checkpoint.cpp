@@ -0,0 +1,192 @@
+// File: src/checkpoint.cpp
+
+#include "checkpoint.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace tourist {
+
+namespace {
+
+constexpr char MAGIC[8] = {'T', 'R', 'C', 'K', 'P', 'T', '0', '1'};
+constexpr std::uint32_t FORMAT_VERSION = 2;
+
+std::uint64_t fnv1a(const unsigned char* data, size_t size) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+template <typename T>
+void append(std::vector<unsigned char>& buffer, const T& value) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+// Sequential reader over a loaded file with bounds checking
+class Reader {
+public:
+    Reader(const std::vector<unsigned char>& buffer, size_t end) : buffer_(buffer), end_(end) {}
+
+    template <typename T>
+    T get() {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    const unsigned char* take(size_t size) {
+        if (size > end_ - pos_) throw std::runtime_error("Truncated checkpoint");
+        const unsigned char* data = buffer_.data() + pos_;
+        pos_ += size;
+        return data;
+    }
+
+private:
+    const std::vector<unsigned char>& buffer_;
+    size_t end_;
+    size_t pos_{0};
+};
+
+} // namespace
+
+void Checkpoint::write(const std::string& path, const CheckpointData& data) {
+    std::vector<unsigned char> buffer;
+    buffer.reserve(72 + data.rng_state.size() + data.records.size() + data.archive.size());
+    
+    buffer.insert(buffer.end(), MAGIC, MAGIC + sizeof(MAGIC));
+    append(buffer, FORMAT_VERSION);
+    append(buffer, data.record_size);
+    append(buffer, data.parameter_hash);
+    append(buffer, data.generation);
+    append(buffer, data.evaluations);
+    append(buffer, static_cast<std::uint64_t>(data.rng_state.size()));
+    buffer.insert(buffer.end(), data.rng_state.begin(), data.rng_state.end());
+    append(buffer, static_cast<std::uint64_t>(data.recordCount()));
+    buffer.insert(buffer.end(), data.records.begin(), data.records.end());
+    append(buffer, static_cast<std::uint64_t>(data.archiveCount()));
+    buffer.insert(buffer.end(), data.archive.begin(), data.archive.end());
+    append(buffer, fnv1a(buffer.data(), buffer.size()));
+    
+    // Write to a temporary file first so an interrupted write never clobbers the last checkpoint
+    const std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open checkpoint file: " + tmp_path);
+        }
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        if (!file) {
+            throw std::runtime_error("Could not write checkpoint file: " + tmp_path);
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        throw std::runtime_error("Could not replace checkpoint file: " + path);
+    }
+}
+
+bool Checkpoint::read(const std::string& path, CheckpointData& data) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    std::vector<unsigned char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (buffer.size() < sizeof(MAGIC) + sizeof(std::uint64_t) ||
+        std::memcmp(buffer.data(), MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a checkpoint file: " + path);
+    }
+    
+    const size_t payload_size = buffer.size() - sizeof(std::uint64_t);
+    std::uint64_t checksum;
+    std::memcpy(&checksum, buffer.data() + payload_size, sizeof(checksum));
+    if (checksum != fnv1a(buffer.data(), payload_size)) {
+        throw std::runtime_error("Corrupt checkpoint file: " + path);
+    }
+    
+    Reader reader(buffer, payload_size);
+    reader.take(sizeof(MAGIC));
+    if (reader.get<std::uint32_t>() != FORMAT_VERSION) {
+        throw std::runtime_error("Unsupported checkpoint version: " + path);
+    }
+    data.record_size = reader.get<std::uint32_t>();
+    data.parameter_hash = reader.get<std::uint64_t>();
+    data.generation = reader.get<std::uint64_t>();
+    data.evaluations = reader.get<std::uint64_t>();
+    
+    auto rng_size = reader.get<std::uint64_t>();
+    const auto* rng_bytes = reader.take(rng_size);
+    data.rng_state.assign(reinterpret_cast<const char*>(rng_bytes), rng_size);
+    
+    auto count = reader.get<std::uint64_t>();
+    if (data.record_size == 0 || count > payload_size / data.record_size) {
+        throw std::runtime_error("Corrupt checkpoint file: " + path);
+    }
+    const auto* record_bytes = reader.take(count * data.record_size);
+    data.records.assign(record_bytes, record_bytes + count * data.record_size);
+    
+    auto archive_count = reader.get<std::uint64_t>();
+    if (archive_count > payload_size / data.record_size) {
+        throw std::runtime_error("Corrupt checkpoint file: " + path);
+    }
+    const auto* archive_bytes = reader.take(archive_count * data.record_size);
+    data.archive.assign(archive_bytes, archive_bytes + archive_count * data.record_size);
+    
+    return true;
+}
+
+// CheckpointWriter implementation
+CheckpointWriter::CheckpointWriter(std::string path)
+    : path_(std::move(path))
+    , thread_(&CheckpointWriter::work, this) {}
+
+CheckpointWriter::~CheckpointWriter() {
+    close();
+}
+
+void CheckpointWriter::submit(CheckpointData data) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_ = std::move(data);
+        has_pending_ = true;
+    }
+    ready_.notify_one();
+}
+
+void CheckpointWriter::close() {
+    if (!thread_.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    ready_.notify_one();
+    thread_.join();
+}
+
+void CheckpointWriter::work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        ready_.wait(lock, [this] { return has_pending_ || stop_; });
+        if (!has_pending_) break;
+        
+        CheckpointData data = std::move(pending_);
+        has_pending_ = false;
+        lock.unlock();
+        
+        try {
+            Checkpoint::write(path_, data);
+        } catch (const std::exception& e) {
+            std::cerr << "Checkpoint error: " << e.what() << std::endl;
+        }
+        
+        lock.lock();
+    }
+}
+
+} // namespace tourist
@@ -0,0 +1,55 @@
+// File: src/crowding.cpp
+
+#include "crowding.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace tourist {
+
+double* CrowdingDistance::reset(size_t n, size_t m) {
+    n_ = n;
+    m_ = m;
+    columns_.resize(n * m);
+    return columns_.data();
+}
+
+const std::vector<double>& CrowdingDistance::compute() {
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+    
+    distances_.assign(n_, 0.0);
+    
+    // With one or two points every point is a boundary point
+    if (n_ <= 2) {
+        std::fill(distances_.begin(), distances_.end(), infinity);
+        return distances_;
+    }
+    
+    order_.resize(n_);
+    for (size_t obj = 0; obj < m_; ++obj) {
+        const double* column = columns_.data() + obj * n_;
+        
+        // Sort indices by this objective
+        std::iota(order_.begin(), order_.end(), 0u);
+        std::sort(order_.begin(), order_.end(),
+                  [column](std::uint32_t a, std::uint32_t b) { return column[a] < column[b]; });
+        
+        // Boundary points are assigned an infinite distance
+        distances_[order_.front()] = infinity;
+        distances_[order_.back()] = infinity;
+        
+        // Skip if all solutions have the same value for this objective
+        double range = column[order_.back()] - column[order_.front()];
+        if (std::fabs(range) < 1e-10) continue;
+        
+        // Interior points accumulate the normalized distance between their neighbours
+        for (size_t i = 1; i < n_ - 1; ++i) {
+            distances_[order_[i]] += (column[order_[i + 1]] - column[order_[i - 1]]) / range;
+        }
+    }
+    
+    return distances_;
+}
+
+} // namespace tourist
@@ -0,0 +1,283 @@
+// File: src/front-metrics.cpp
+
+#include "front-metrics.hpp"
+#include "hypervolume.hpp"
+#include "results-format.hpp"
+#include "thread-pool.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace tourist {
+namespace utils {
+
+namespace {
+
+constexpr size_t M = ResultFront::NUM_OBJECTIVES;
+
+bool weaklyDominates(const double* a, const double* b) {
+    for (size_t i = 0; i < M; ++i) {
+        if (a[i] > b[i]) return false;
+    }
+    return true;
+}
+
+std::vector<std::string> split(const std::string& line, char delimiter) {
+    std::vector<std::string> fields;
+    std::stringstream stream(line);
+    std::string field;
+    while (std::getline(stream, field, delimiter)) {
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+// Reads a number written with a decimal point or a decimal comma
+bool parseNumber(std::string text, double& value) {
+    std::replace(text.begin(), text.end(), ',', '.');
+    const char* begin = text.c_str();
+    char* end = nullptr;
+    value = std::strtod(begin, &end);
+    return end != begin;
+}
+
+std::vector<double> loadCsv(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Erro ao abrir arquivo de resultados: " + path);
+    }
+
+    std::string line;
+    std::getline(file, line);
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    const std::vector<std::string> header = split(line, ';');
+    const char* names[M] = {"CustoTotal", "TempoTotal", "NumAtracoes", "NumBairros"};
+    size_t columns[M];
+    for (size_t i = 0; i < M; ++i) {
+        auto it = std::find(header.begin(), header.end(), names[i]);
+        if (it == header.end()) {
+            throw std::runtime_error("Coluna " + std::string(names[i]) + " ausente no arquivo de resultados: " + path);
+        }
+        columns[i] = static_cast<size_t>(it - header.begin());
+    }
+    const size_t needed = *std::max_element(columns, columns + M) + 1;
+
+    // Rows with missing or unreadable objectives are skipped
+    std::vector<double> values;
+    while (std::getline(file, line)) {
+        const std::vector<std::string> fields = split(line, ';');
+        if (fields.size() < needed) continue;
+        double point[M];
+        bool valid = true;
+        for (size_t i = 0; i < M && valid; ++i) {
+            valid = parseNumber(fields[columns[i]], point[i]);
+        }
+        if (!valid) continue;
+        values.insert(values.end(), {point[0], point[1], -point[2], -point[3]});
+    }
+    return values;
+}
+
+std::vector<double> loadBinary(const std::string& path) {
+    const ResultsTable table = ResultsFormat::read(path);
+    std::vector<double> values;
+    values.reserve(table.size() * M);
+    for (size_t i = 0; i < table.size(); ++i) {
+        values.insert(values.end(), {table.cost[i], table.time[i],
+                                     -static_cast<double>(table.attractions[i]),
+                                     -static_cast<double>(table.neighborhoods[i])});
+    }
+    return values;
+}
+
+// Normalization bounds: the problem's ideal and nadir points, widened to the
+// reference front where it goes beyond them
+void normalizationBounds(const std::vector<double>& reference_front, FrontMetrics::Point& ideal,
+                         FrontMetrics::Point& nadir) {
+    ideal = FrontMetrics::IDEAL_POINT;
+    nadir = FrontMetrics::NADIR_POINT;
+    for (size_t j = 0; j < reference_front.size(); j += M) {
+        for (size_t i = 0; i < M; ++i) {
+            ideal[i] = std::min(ideal[i], reference_front[j + i]);
+            nadir[i] = std::max(nadir[i], reference_front[j + i]);
+        }
+    }
+}
+
+// Row-major points with every objective scaled to [0, 1] over the bounds
+std::vector<double> normalized(const std::vector<double>& values, const FrontMetrics::Point& ideal,
+                               const FrontMetrics::Point& nadir) {
+    std::vector<double> scaled(values.size());
+    for (size_t j = 0; j < scaled.size(); ++j) {
+        const size_t objective = j % M;
+        scaled[j] = (values[j] - ideal[objective]) / (nadir[objective] - ideal[objective]);
+    }
+    return scaled;
+}
+
+ObjectiveSet objectiveSet(const std::vector<double>& values) {
+    return ObjectiveSet::fromRows(values.data(), values.size() / M, M);
+}
+
+bool endsWith(const std::string& text, const std::string& suffix) {
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // namespace
+
+ResultFront FrontMetrics::load(const std::string& path) {
+    ResultFront front;
+    front.path = path;
+    front.algorithm = algorithmName(path);
+    const std::vector<double> values = endsWith(path, ".bin") ? loadBinary(path) : loadCsv(path);
+    front.solutions = values.size() / M;
+    front.values = nondominated(values);
+    return front;
+}
+
+std::vector<ResultFront> FrontMetrics::load(const std::vector<std::string>& paths, size_t threads) {
+    std::vector<ResultFront> fronts(paths.size());
+    ThreadPool::parallelFor(paths.size(), threads, [&](size_t i) { fronts[i] = load(paths[i]); });
+    return fronts;
+}
+
+std::vector<std::string> FrontMetrics::findResultFiles(const std::string& directory) {
+    std::vector<std::string> paths;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        if (entry.is_regular_file() && endsWith(entry.path().filename().string(), "resultados.csv")) {
+            paths.push_back(entry.path().string());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+std::string FrontMetrics::algorithmName(const std::string& path) {
+    std::string base = std::filesystem::path(path).stem().string();
+    std::transform(base.begin(), base.end(), base.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (endsWith(base, "resultados")) {
+        base.resize(base.size() - std::string("resultados").size());
+        if (!base.empty() && base.back() == '-') base.pop_back();
+    }
+
+    if (base == "nsga2") return "NSGA-II";
+    if (base == "moead") return "MOEA/D";
+    if (base == "spea2") return "SPEA2";
+    if (base == "movns") return "MOVNS";
+
+    // Other names in title case, underscores read as spaces
+    std::string name;
+    bool word_start = true;
+    for (char c : base) {
+        if (c == '_') c = ' ';
+        const bool letter = std::isalpha(static_cast<unsigned char>(c)) != 0;
+        name += static_cast<char>(letter && word_start ? std::toupper(static_cast<unsigned char>(c)) : c);
+        word_start = !letter;
+    }
+    return name;
+}
+
+// After sorting lexicographically no point is weakly dominated by a later one,
+// so each point only needs to be checked against those already kept
+std::vector<double> FrontMetrics::nondominated(const std::vector<double>& values) {
+    const size_t count = values.size() / M;
+    std::vector<size_t> order(count);
+    for (size_t i = 0; i < count; ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&values](size_t a, size_t b) {
+        return std::lexicographical_compare(&values[a * M], &values[a * M] + M, &values[b * M], &values[b * M] + M);
+    });
+
+    std::vector<double> front;
+    for (size_t index : order) {
+        const double* candidate = &values[index * M];
+        bool dominated = false;
+        for (size_t j = 0; j < front.size() && !dominated; j += M) {
+            dominated = weaklyDominates(&front[j], candidate);
+        }
+        if (!dominated) front.insert(front.end(), candidate, candidate + M);
+    }
+    return front;
+}
+
+std::vector<double> FrontMetrics::referenceFront(const std::vector<ResultFront>& fronts) {
+    std::vector<double> merged;
+    for (const auto& front : fronts) {
+        merged.insert(merged.end(), front.values.begin(), front.values.end());
+    }
+    return nondominated(merged);
+}
+
+std::vector<FrontHypervolume> FrontMetrics::hypervolumes(
+    const std::vector<ResultFront>& fronts,
+    const std::vector<double>& reference_front,
+    size_t threads
+) {
+    Point ideal;
+    Point nadir;
+    normalizationBounds(reference_front, ideal, nadir);
+    Point normalized_reference;
+    for (size_t i = 0; i < M; ++i) {
+        normalized_reference[i] = (REFERENCE_POINT[i] - ideal[i]) / (nadir[i] - ideal[i]);
+    }
+
+    const double reference_volume = HypervolumeCalculator::calculateParallel(
+        reference_front.data(), reference_front.size() / M, M, REFERENCE_POINT.data(), 0, threads);
+
+    std::vector<FrontHypervolume> result(fronts.size());
+    ThreadPool::parallelFor(fronts.size(), threads, [&](size_t f) {
+        const ResultFront& front = fronts[f];
+        const std::vector<double> scaled = normalized(front.values, ideal, nadir);
+        result[f].raw = HypervolumeCalculator::calculate(front.values.data(), front.size(), M,
+                                                         REFERENCE_POINT.data(), 0);
+        result[f].normalized = HypervolumeCalculator::calculate(scaled.data(), front.size(), M,
+                                                                normalized_reference.data(), 0);
+        result[f].ratio = reference_volume > 0.0 ? result[f].raw / reference_volume : 0.0;
+    });
+    return result;
+}
+
+std::vector<IndicatorValues> FrontMetrics::indicators(
+    const std::vector<ResultFront>& fronts,
+    const std::vector<double>& reference_front,
+    size_t threads
+) {
+    Point ideal;
+    Point nadir;
+    normalizationBounds(reference_front, ideal, nadir);
+    const ObjectiveSet reference = objectiveSet(normalized(reference_front, ideal, nadir));
+    const ReferenceIndex index(reference);
+
+    std::vector<IndicatorValues> result(fronts.size());
+    ThreadPool::parallelFor(fronts.size(), threads, [&](size_t f) {
+        const ObjectiveSet front = objectiveSet(normalized(fronts[f].values, ideal, nadir));
+        result[f] = QualityIndicators::evaluate(front, reference, &index);
+    });
+    return result;
+}
+
+double FrontMetrics::coverage(const ResultFront& a, const ResultFront& b) {
+    return QualityIndicators::coverage(objectiveSet(a.values), objectiveSet(b.values));
+}
+
+std::vector<double> FrontMetrics::coverageMatrix(const std::vector<ResultFront>& fronts, size_t threads) {
+    const size_t count = fronts.size();
+    std::vector<ObjectiveSet> sets;
+    sets.reserve(count);
+    for (const auto& front : fronts) sets.push_back(objectiveSet(front.values));
+
+    std::vector<double> matrix(count * count, 0.0);
+    ThreadPool::parallelFor(count, threads, [&](size_t a) {
+        for (size_t b = 0; b < count; ++b) {
+            if (a != b) matrix[a * count + b] = QualityIndicators::coverage(sets[a], sets[b]);
+        }
+    });
+    return matrix;
+}
+
+} // namespace utils
+} // namespace tourist
@@ -0,0 +1,264 @@
+// File: src/hypervolume-estimator.cpp
+
+#include "hypervolume-estimator.hpp"
+#include "chromosome.hpp"
+#include "thread-pool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace tourist {
+namespace utils {
+
+namespace {
+
+constexpr size_t BLOCK = 64;  // Points tested against a sample per vectorized step
+
+// z such that a standard normal falls within [-z, z] with the given probability
+double normalQuantile(double confidence) {
+    double low = 0.0;
+    double high = 40.0;
+    for (int i = 0; i < 100; ++i) {
+        double middle = 0.5 * (low + high);
+        if (std::erf(middle / std::sqrt(2.0)) < confidence) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return 0.5 * (low + high);
+}
+
+// Uniform doubles in [0, 1) from a SplitMix64 stream keyed by seed and batch
+class SampleStream {
+public:
+    SampleStream(std::uint64_t seed, std::uint64_t batch) : state_(mixHash(seed ^ mixHash(batch + 1))) {}
+
+    double next() {
+        state_ += 0x9e3779b97f4a7c15ULL;
+        return static_cast<double>(mixHash(state_) >> 11) * 0x1.0p-53;
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+// Minimized points inside the reference box, one column per objective, in
+// increasing order of the first objective
+struct FrontColumns {
+    size_t dimensions{0};
+    size_t size{0};
+    std::vector<double> columns;    // Objective i of point j at columns[i * size + j]
+    std::vector<double> block_lower; // Best value of objective i in block b at block_lower[b * dimensions + i]
+    std::vector<double> lower;      // Best value of each objective
+    std::vector<double> width;      // Reference minus lower
+};
+
+// Counts the samples of one batch dominated by the front
+std::uint64_t countHits(const FrontColumns& front, std::uint64_t seed, std::uint64_t batch, size_t count,
+                        std::vector<double>& samples) {
+    const size_t d = front.dimensions;
+    const size_t m = front.size;
+    samples.resize(d * count);
+    SampleStream stream(seed, batch);
+    for (size_t i = 0; i < d; ++i) {
+        double* column = &samples[i * count];
+        for (size_t s = 0; s < count; ++s) {
+            column[s] = front.lower[i] + front.width[i] * stream.next();
+        }
+    }
+
+    const double* first = front.columns.data();
+    std::uint64_t hits = 0;
+    for (size_t s = 0; s < count; ++s) {
+        // Only points no worse than the sample in the first objective can dominate
+        // it; those closest to it in that objective are tried first
+        const size_t candidates = std::upper_bound(first, first + m, samples[s]) - first;
+        unsigned char hit = 0;
+        for (size_t block = (candidates + BLOCK - 1) / BLOCK; block-- > 0 && !hit;) {
+            const size_t start = block * BLOCK;
+            // Skip blocks whose best corner already fails to dominate the sample
+            const double* corner = &front.block_lower[block * d];
+            bool reachable = true;
+            for (size_t i = 1; i < d && reachable; ++i) {
+                reachable = corner[i] <= samples[i * count + s];
+            }
+            if (!reachable) continue;
+
+            const size_t length = std::min(BLOCK, candidates - start);
+            unsigned char covered[BLOCK];
+            for (size_t j = 0; j < length; ++j) covered[j] = 1;
+            for (size_t i = 1; i < d; ++i) {
+                const double* column = &front.columns[i * m + start];
+                const double x = samples[i * count + s];
+                for (size_t j = 0; j < length; ++j) {
+                    covered[j] &= static_cast<unsigned char>(column[j] <= x);
+                }
+            }
+            for (size_t j = 0; j < length; ++j) hit |= covered[j];
+        }
+        hits += hit;
+    }
+    return hits;
+}
+
+// Estimate and Wilson score interval of the hit ratio, scaled by the box volume
+void updateInterval(HypervolumeEstimate& result, double z) {
+    const double n = static_cast<double>(result.samples);
+    const double ratio = static_cast<double>(result.hits) / n;
+    const double denominator = 1.0 + z * z / n;
+    const double center = (ratio + z * z / (2.0 * n)) / denominator;
+    const double half = z * std::sqrt(ratio * (1.0 - ratio) / n + z * z / (4.0 * n * n)) / denominator;
+    result.value = result.box_volume * ratio;
+    result.lower = result.box_volume * std::max(0.0, center - half);
+    result.upper = result.box_volume * std::min(1.0, center + half);
+}
+
+} // namespace
+
+double HypervolumeEstimate::relativeError() const {
+    if (upper <= lower) return 0.0;
+    if (value <= 0.0) return std::numeric_limits<double>::infinity();
+    return 0.5 * (upper - lower) / value;
+}
+
+HypervolumeEstimator::HypervolumeEstimator(Options options) : options_(options) {
+    if (options_.batch_size == 0) throw std::invalid_argument("Batch size must be positive");
+    if (!(options_.confidence > 0.0 && options_.confidence < 1.0)) {
+        throw std::invalid_argument("Confidence must lie strictly between 0 and 1");
+    }
+    if (options_.target_relative_error < 0.0 || options_.max_seconds < 0.0) {
+        throw std::invalid_argument("Estimator precision and time limits cannot be negative");
+    }
+}
+
+HypervolumeEstimate HypervolumeEstimator::estimate(
+    const std::vector<std::vector<double>>& points,
+    const std::vector<double>& reference_point,
+    unsigned maximize_mask
+) const {
+    std::vector<double> values;
+    values.reserve(points.size() * reference_point.size());
+    for (const auto& point : points) {
+        if (point.size() != reference_point.size()) {
+            throw std::runtime_error("Dimensions mismatch between points and reference point");
+        }
+        values.insert(values.end(), point.begin(), point.end());
+    }
+    return estimate(values.data(), points.size(), reference_point.size(), reference_point.data(), maximize_mask);
+}
+
+HypervolumeEstimate HypervolumeEstimator::estimate(
+    const double* values,
+    size_t num_points,
+    size_t num_objectives,
+    const double* reference_point,
+    unsigned maximize_mask
+) const {
+    const size_t d = num_objectives;
+    HypervolumeEstimate result;
+    if (d == 0 || num_points == 0) return result;
+
+    if (d > HypervolumeCalculator::MAX_OBJECTIVES) {
+        throw std::invalid_argument("Too many objectives for hypervolume estimation");
+    }
+
+    // Minimize every objective and keep the points that dominate the reference
+    auto minimized = [maximize_mask](double value, size_t objective) {
+        return (maximize_mask >> objective) & 1u ? -value : value;
+    };
+    std::vector<double> reference(d);
+    for (size_t i = 0; i < d; ++i) {
+        reference[i] = minimized(reference_point[i], i);
+    }
+    std::vector<double> inside;
+    for (size_t p = 0; p < num_points; ++p) {
+        const double* point = values + p * d;
+        bool encloses = true;
+        for (size_t i = 0; i < d && encloses; ++i) {
+            encloses = minimized(point[i], i) < reference[i];
+        }
+        if (!encloses) continue;
+        for (size_t i = 0; i < d; ++i) {
+            inside.push_back(minimized(point[i], i));
+        }
+    }
+    const size_t m = inside.size() / d;
+    if (m == 0) return result;
+
+    std::vector<size_t> order(m);
+    for (size_t j = 0; j < m; ++j) order[j] = j;
+    std::sort(order.begin(), order.end(), [&inside, d](size_t a, size_t b) { return inside[a * d] < inside[b * d]; });
+
+    FrontColumns front;
+    front.dimensions = d;
+    front.size = m;
+    front.columns.resize(d * m);
+    front.lower.assign(d, std::numeric_limits<double>::max());
+    front.width.resize(d);
+    for (size_t j = 0; j < m; ++j) {
+        for (size_t i = 0; i < d; ++i) {
+            double value = inside[order[j] * d + i];
+            front.columns[i * m + j] = value;
+            front.lower[i] = std::min(front.lower[i], value);
+        }
+    }
+    const size_t blocks = (m + BLOCK - 1) / BLOCK;
+    front.block_lower.assign(blocks * d, std::numeric_limits<double>::max());
+    for (size_t j = 0; j < m; ++j) {
+        for (size_t i = 0; i < d; ++i) {
+            double& corner = front.block_lower[(j / BLOCK) * d + i];
+            corner = std::min(corner, front.columns[i * m + j]);
+        }
+    }
+    result.box_volume = 1.0;
+    for (size_t i = 0; i < d; ++i) {
+        front.width[i] = reference[i] - front.lower[i];
+        result.box_volume *= front.width[i];
+    }
+
+    // Batches run in rounds of a few per thread on workers started once; hits
+    // are summed in batch order and only the time limit is checked between rounds
+    const size_t batch_size = options_.batch_size;
+    const std::uint64_t total_batches = (options_.max_samples + batch_size - 1) / batch_size;
+    const size_t threads = static_cast<size_t>(
+        std::min<std::uint64_t>(ThreadPool::resolve(options_.threads), std::max<std::uint64_t>(total_batches, 1)));
+    ThreadPool pool(threads);
+    const size_t round_batches = threads * 4;
+    const double z = normalQuantile(options_.confidence);
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::uint64_t> batch_hits(round_batches);
+    std::vector<std::vector<double>> samples(threads);
+    auto batchSamples = [this, batch_size](std::uint64_t batch) {
+        return static_cast<size_t>(std::min<std::uint64_t>(batch_size, options_.max_samples - batch * batch_size));
+    };
+
+    for (std::uint64_t first = 0; first < total_batches; first += round_batches) {
+        const size_t count = static_cast<size_t>(std::min<std::uint64_t>(round_batches, total_batches - first));
+        pool.run(count, [&](size_t k, size_t worker) {
+            batch_hits[k] = countHits(front, options_.seed, first + k, batchSamples(first + k), samples[worker]);
+        });
+
+        // Batches are taken in order and the precision target is checked after
+        // each one, so where the estimate stops does not depend on the round size
+        bool precise = false;
+        for (size_t k = 0; k < count && !precise; ++k) {
+            result.hits += batch_hits[k];
+            result.samples += batchSamples(first + k);
+            updateInterval(result, z);
+            precise = options_.target_relative_error > 0.0 &&
+                      result.relativeError() <= options_.target_relative_error;
+        }
+        if (precise) break;
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (options_.max_seconds > 0.0 && elapsed.count() >= options_.max_seconds) break;
+    }
+    return result;
+}
+
+} // namespace utils
+} // namespace tourist
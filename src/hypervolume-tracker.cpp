@@ -0,0 +1,69 @@
+// File: src/hypervolume-tracker.cpp
+
+#include "hypervolume-tracker.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace tourist {
+namespace utils {
+
+HypervolumeTracker::HypervolumeTracker(std::vector<double> reference_point, unsigned maximize_mask)
+    : reference_(std::move(reference_point)), maximize_mask_(maximize_mask) {
+    if (reference_.empty()) {
+        throw std::invalid_argument("Hypervolume reference point cannot be empty");
+    }
+}
+
+double HypervolumeTracker::insert(std::uint64_t id, const double* point) {
+    if (contains(id)) {
+        throw std::invalid_argument("Point id is already tracked");
+    }
+    const size_t n = dimensions();
+    double gained = HypervolumeCalculator::contribution(point, values_.data(), ids_.size(), n,
+                                                        reference_.data(), maximize_mask_);
+    rows_.emplace(id, ids_.size());
+    ids_.push_back(id);
+    values_.insert(values_.end(), point, point + n);
+    volume_ += gained;
+    return gained;
+}
+
+double HypervolumeTracker::remove(std::uint64_t id) {
+    auto it = rows_.find(id);
+    if (it == rows_.end()) return 0.0;
+    const size_t n = dimensions();
+    const size_t row = it->second;
+    const size_t last = ids_.size() - 1;
+    rows_.erase(it);
+
+    // Move the last row into the hole
+    removed_.assign(values_.begin() + row * n, values_.begin() + (row + 1) * n);
+    if (row != last) {
+        std::copy_n(values_.begin() + last * n, n, values_.begin() + row * n);
+        ids_[row] = ids_[last];
+        rows_[ids_[row]] = row;
+    }
+    ids_.pop_back();
+    values_.resize(last * n);
+
+    double lost = HypervolumeCalculator::contribution(removed_.data(), values_.data(), ids_.size(), n,
+                                                      reference_.data(), maximize_mask_);
+    volume_ -= lost;
+    return lost;
+}
+
+double HypervolumeTracker::refresh() {
+    volume_ = HypervolumeCalculator::calculate(values_.data(), ids_.size(), dimensions(), reference_.data(),
+                                               maximize_mask_);
+    return volume_;
+}
+
+void HypervolumeTracker::clear() {
+    values_.clear();
+    ids_.clear();
+    rows_.clear();
+    volume_ = 0.0;
+}
+
+} // namespace utils
+} // namespace tourist
@@ -1,79 +1,671 @@
 // File: src/hypervolume.cpp
 
 #include "hypervolume.hpp"
-#include <iostream> 
+#include "thread-pool.hpp"
+#include <iterator>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <utility>
 
 namespace tourist {
 namespace utils {
 
-// Point implementation
-HypervolumeCalculator::Point::Point(const Solution& solution) {
-    this->objectives = solution.getObjectives();
+namespace {
+
+// Objective I is maximized under the sense mask
+template <unsigned Mask, size_t I>
+constexpr bool maximized() {
+    return (Mask >> I) & 1u;
 }
 
-bool HypervolumeCalculator::Point::dominates(const Point& other, size_t k) const {
-    // For HSO algorithm with mixed objectives (minimization/maximization)
-    // As per While et al. 2006: "A point dominates another if it's at least as good 
-    // in all objectives and strictly better in at least one"
-    bool strictly_better = false;
-    
-    for (size_t i = k; i < objectives.size(); ++i) {
-        if (i == 2) { // Third objective (attractions visited) is to be maximized
-            // For maximization, higher values are better
-            if (objectives[i] < other.objectives[i]) return false;
-            if (objectives[i] > other.objectives[i]) strictly_better = true;
-        } else { // First two objectives (cost and time) are to be minimized
-            // For minimization, lower values are better
-            if (objectives[i] > other.objectives[i]) return false;
-            if (objectives[i] < other.objectives[i]) strictly_better = true;
+// Distance from a value to a worse one along objective I
+template <unsigned Mask, size_t I>
+inline double gap(double value, double worse) {
+    if constexpr (maximized<Mask, I>()) {
+        return value - worse;
+    } else {
+        return worse - value;
+    }
+}
+
+// True if a is at least as good as b in objectives [I, D)
+template <size_t D, unsigned Mask, size_t I>
+inline bool weaklyDominates(const double* a, const double* b) {
+    if constexpr (I == D) {
+        return true;
+    } else if constexpr (maximized<Mask, I>()) {
+        return (a[I] >= b[I]) & weaklyDominates<D, Mask, I + 1>(a, b);
+    } else {
+        return (a[I] <= b[I]) & weaklyDominates<D, Mask, I + 1>(a, b);
+    }
+}
+
+// True if the point is strictly better than the reference in objectives [I, D)
+template <size_t D, unsigned Mask, size_t I = 0>
+inline bool encloses(const double* point, const double* reference) {
+    if constexpr (I == D) {
+        return true;
+    } else {
+        return (gap<Mask, I>(point[I], reference[I]) > 0.0) & encloses<D, Mask, I + 1>(point, reference);
+    }
+}
+
+// Value of objective I turned into one to be minimized
+template <unsigned Mask, size_t I>
+inline double minimized(double value) {
+    if constexpr (maximized<Mask, I>()) {
+        return -value;
+    } else {
+        return value;
+    }
+}
+
+using Point3 = std::array<double, 3>;
+
+constexpr size_t TASKS_PER_THREAD = 8;       // Slices handed out per worker in each round
+constexpr size_t PARALLEL_MIN_POINTS = 256;  // Smaller fronts are measured on the calling thread
+
+/**
+ * Volume of 3D points, all minimized and strictly inside the reference, by the
+ * sweep of Beume et al. (2009): points enter in increasing z while the area
+ * dominated by their (x, y) projections is kept as a staircase in a balanced
+ * tree. Each point is inserted and erased at most once, so the sweep runs in
+ * O(n log n). Points are reordered in place.
+ */
+class Staircase3D {
+public:
+    double volume(Point3* points, size_t count, const Point3& reference) {
+        std::sort(points, points + count, [](const Point3& a, const Point3& b) { return a[2] < b[2]; });
+        return sweep(points, count, reference);
+    }
+
+    // Same, for points already in increasing z
+    double sweep(const Point3* points, size_t count, const Point3& reference) {
+        steps_.clear();
+
+        double area = 0.0;
+        double volume = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            area += insert(points[i][0], points[i][1], reference);
+            double next_z = i + 1 < count ? points[i + 1][2] : reference[2];
+            volume += area * (next_z - points[i][2]);
         }
+        return volume;
     }
-    
-    return strictly_better;
+
+private:
+    // Adds (x, y) to the staircase and returns the area it adds to it
+    double insert(double x, double y, const Point3& reference) {
+        auto it = steps_.lower_bound(x);
+        double height;  // Covered down to this y just right of x
+        if (it != steps_.end() && it->first == x) {
+            if (it->second <= y) return 0.0;
+            height = it->second;
+            it = steps_.erase(it);
+        } else if (it != steps_.begin()) {
+            auto previous = std::prev(it);
+            if (previous->second <= y) return 0.0;
+            height = previous->second;
+        } else {
+            height = reference[1];
+        }
+
+        // Steps to the right that are no lower than y are now dominated
+        double added = 0.0;
+        double left = x;
+        while (it != steps_.end() && it->second >= y) {
+            added += (it->first - left) * (height - y);
+            left = it->first;
+            height = it->second;
+            it = steps_.erase(it);
+        }
+        double right = it != steps_.end() ? it->first : reference[0];
+        added += (right - left) * (height - y);
+
+        steps_.emplace_hint(it, x, y);
+        return added;
+    }
+
+    std::map<double, double> steps_;  // x -> y; y strictly decreases with x
+};
+
+/**
+ * Exact hypervolume for D objectives under a fixed sense mask. The slicing
+ * objective K is a template parameter too, so every comparison is resolved at
+ * compile time.
+ *
+ * Three objectives are measured by the staircase sweep. Four objectives are
+ * swept along the first one while the 3D volume of the points seen so far is
+ * updated by each point's exclusive contribution, computed on its limit set
+ * (While et al., WFG): the other points clipped to the new point's box. Higher
+ * dimensions are sliced (HSO) down to four.
+ *
+ * Spans hold indices of mutually non-dominated points; the arena after the top
+ * span provides capacity indices per recursion level, and limits holds capacity
+ * clipped points.
+ *
+ * runParallel() measures the contributions of the four-objective sweep on a
+ * ThreadPool. Points are prepared in rounds, each with a copy of the set sweep4D
+ * would measure it against, and the contributions are added in point order, so
+ * the volume is the serial one bit for bit.
+ */
+template <size_t D, unsigned Mask>
+class HsoKernel {
+    static_assert(D >= 2, "HSO kernels need at least two objectives");
+
+public:
+    HsoKernel(const double* values, const double* reference, size_t capacity, Point3* limits)
+        : values_(values), reference_(reference), capacity_(capacity), limits_(limits) {}
+
+    double run(std::uint32_t* span, size_t num_points) const {
+        size_t count = enclosed(span, num_points);
+        return count == 0 ? 0.0 : hso<0>(span, count, span + capacity_);
+    }
+
+    double runParallel(std::uint32_t* span, size_t num_points, ThreadPool& pool) const {
+        if constexpr (D == 4) {
+            size_t count = enclosed(span, num_points);
+            return count == 0 ? 0.0 : sweep4DParallel(span, count, span + capacity_, pool);
+        } else {
+            return run(span, num_points);
+        }
+    }
+
+private:
+    // Only points strictly better than the reference in every objective enclose
+    // volume. The sweeps skip dominated points by themselves; for slicing they
+    // are filtered in place (the write position never passes p).
+    size_t enclosed(std::uint32_t* span, size_t num_points) const {
+        size_t count = 0;
+        for (size_t p = 0; p < num_points; ++p) {
+            if (!encloses<D, Mask>(point(p), reference_)) continue;
+            if constexpr (D <= 4) {
+                span[count++] = static_cast<std::uint32_t>(p);
+            } else {
+                insert<0>(span, count, static_cast<std::uint32_t>(p));
+            }
+        }
+        return count;
+    }
+
+    const double* point(size_t index) const { return values_ + index * D; }
+
+    // Objectives [K, K+3) of a point, minimized
+    template <size_t K>
+    Point3 minimizedPoint(const double* p) const {
+        return {minimized<Mask, K>(p[K]), minimized<Mask, K + 1>(p[K + 1]), minimized<Mask, K + 2>(p[K + 2])};
+    }
+
+    // True if a member of the span weakly dominates the candidate in objectives [K, D)
+    template <size_t K>
+    bool dominated(const std::uint32_t* span, size_t count, const double* candidate) const {
+        for (size_t j = 0; j < count; ++j) {
+            if (weaklyDominates<D, Mask, K>(point(span[j]), candidate)) return true;
+        }
+        return false;
+    }
+
+    // Adds a point to a non-dominated span in objectives [K, D); dominated
+    // members are dropped by compacting the span
+    template <size_t K>
+    void insert(std::uint32_t* span, size_t& count, std::uint32_t index) const {
+        if (!dominated<K>(span, count, point(index))) {
+            add<K>(span, count, index);
+        }
+    }
+
+    // Same, for a point known not to be weakly dominated by the span
+    template <size_t K>
+    void add(std::uint32_t* span, size_t& count, std::uint32_t index) const {
+        const double* candidate = point(index);
+        // Equal points are weakly dominated, so whatever the candidate weakly
+        // dominates is strictly dominated
+        size_t kept = 0;
+        for (size_t j = 0; j < count; ++j) {
+            if (!weaklyDominates<D, Mask, K>(candidate, point(span[j]))) {
+                span[kept++] = span[j];
+            }
+        }
+        span[kept] = index;
+        count = kept + 1;
+    }
+
+    // Best first in objective K
+    template <size_t K>
+    void sortBy(std::uint32_t* span, size_t count) const {
+        const double* values = values_;
+        std::sort(span, span + count, [values](std::uint32_t a, std::uint32_t b) {
+            if constexpr (maximized<Mask, K>()) {
+                return values[a * D + K] > values[b * D + K];
+            } else {
+                return values[a * D + K] < values[b * D + K];
+            }
+        });
+    }
+
+    template <size_t K>
+    double hso(std::uint32_t* span, size_t count, std::uint32_t* scratch) const {
+        if constexpr (D == 2) {
+            return calculate2D(span, count);
+        } else if constexpr (K + 3 == D) {
+            return sweep3D<K>(span, count);
+        } else if constexpr (K + 4 == D) {
+            return sweep4D<K>(span, count, scratch);
+        } else {
+            sortBy<K>(span, count);
+
+            // The slice between the ith point and the next one (or the reference)
+            // in objective K is covered by the first i+1 points. Their non-dominated
+            // set in objectives [K+1, D) is kept in scratch and grows one point per
+            // slice; the deeper levels only reorder it.
+            double volume = 0.0;
+            size_t slice_count = 0;
+            for (size_t i = 0; i < count; ++i) {
+                insert<K + 1>(scratch, slice_count, span[i]);
+
+                double next = i + 1 < count ? point(span[i + 1])[K] : reference_[K];
+                double depth = gap<Mask, K>(point(span[i])[K], next);
+                if (depth > 0.0) {
+                    volume += depth * hso<K + 1>(scratch, slice_count, scratch + capacity_);
+                }
+            }
+            return volume;
+        }
+    }
+
+    template <size_t K>
+    double sweep3D(const std::uint32_t* span, size_t count) const {
+        for (size_t i = 0; i < count; ++i) {
+            limits_[i] = minimizedPoint<K>(point(span[i]));
+        }
+        return staircase_.volume(limits_, count, minimizedPoint<K>(reference_));
+    }
+
+    // Sweep along objective K. The slice beyond the ith point is covered by the
+    // first i+1 points; their non-dominated set in the last three objectives is
+    // kept in scratch together with its 3D volume, which grows by the exclusive
+    // contribution of each point that enters it. The set is kept ordered by its
+    // last objective, so clipped copies come out ready for the staircase sweep.
+    template <size_t K>
+    double sweep4D(std::uint32_t* span, size_t count, std::uint32_t* scratch) const {
+        sortBy<K>(span, count);
+        const Point3 reference = minimizedPoint<K + 1>(reference_);
+
+        double volume = 0.0;
+        double slice_volume = 0.0;
+        size_t slice_count = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const double* current = point(span[i]);
+            double contribution;
+            if (contribution3D<K + 1>(current, scratch, slice_count, reference, contribution)) {
+                slice_volume += contribution;
+                addOrdered<K + 1>(scratch, slice_count, span[i]);
+            }
+            double next = i + 1 < count ? point(span[i + 1])[K] : reference_[K];
+            volume += gap<Mask, K>(current[K], next) * slice_volume;
+        }
+        return volume;
+    }
+
+    // sweep4D<0> with the contributions measured by the pool. Each worker has its
+    // own kernel, hence its own clipped points and staircase.
+    double sweep4DParallel(std::uint32_t* span, size_t count, std::uint32_t* scratch, ThreadPool& pool) const {
+        sortBy<0>(span, count);
+        const Point3 reference = minimizedPoint<1>(reference_);
+
+        std::vector<std::vector<Point3>> limits(pool.size(), std::vector<Point3>(count));
+        std::vector<HsoKernel> workers;
+        workers.reserve(pool.size());
+        for (auto& buffer : limits) {
+            workers.emplace_back(values_, reference_, capacity_, buffer.data());
+        }
+
+        const size_t round = pool.size() * TASKS_PER_THREAD;
+        std::vector<std::uint32_t> sets;  // Set each point of the round is measured against, back to back
+        std::vector<size_t> offsets(round + 1);
+        std::vector<unsigned char> entering(round);
+        std::vector<double> contributions(round);
+
+        double volume = 0.0;
+        double slice_volume = 0.0;
+        size_t slice_count = 0;
+        for (size_t first = 0; first < count; first += round) {
+            const size_t tasks = std::min(round, count - first);
+
+            // A point enters the set unless a member weakly dominates it, which is
+            // when contribution3D would refuse it
+            sets.clear();
+            for (size_t k = 0; k < tasks; ++k) {
+                const std::uint32_t index = span[first + k];
+                offsets[k] = sets.size();
+                entering[k] = !dominated<1>(scratch, slice_count, point(index));
+                if (entering[k]) {
+                    sets.insert(sets.end(), scratch, scratch + slice_count);
+                    addOrdered<1>(scratch, slice_count, index);
+                }
+            }
+            offsets[tasks] = sets.size();
+
+            pool.run(tasks, [&](size_t k, size_t worker) {
+                if (!entering[k]) return;
+                workers[worker].template contribution3D<1>(point(span[first + k]), sets.data() + offsets[k],
+                                                           offsets[k + 1] - offsets[k], reference,
+                                                           contributions[k]);
+            });
+
+            for (size_t k = 0; k < tasks; ++k) {
+                const size_t i = first + k;
+                if (entering[k]) slice_volume += contributions[k];
+                double next = i + 1 < count ? point(span[i + 1])[0] : reference_[0];
+                volume += gap<Mask, 0>(point(span[i])[0], next) * slice_volume;
+            }
+        }
+        return volume;
+    }
+
+    // add() for a span ordered best first by objective K+2, keeping the order
+    template <size_t K>
+    void addOrdered(std::uint32_t* span, size_t& count, std::uint32_t index) const {
+        add<K>(span, count, index);
+        const double z = minimized<Mask, K + 2>(point(index)[K + 2]);
+        size_t position = count - 1;
+        for (; position > 0 && minimized<Mask, K + 2>(point(span[position - 1])[K + 2]) > z; --position) {
+            span[position] = span[position - 1];
+        }
+        span[position] = index;
+    }
+
+    // Volume in objectives [K, K+3) dominated by p and by no member of the span:
+    // p's box minus the volume of the members clipped to that box. The span is
+    // ordered by objective K+2, and clipping keeps that order. Returns false,
+    // without a contribution, if a member weakly dominates p (its clipped copy is
+    // p itself).
+    template <size_t K>
+    bool contribution3D(const double* p, const std::uint32_t* span, size_t count,
+                        const Point3& reference, double& contribution) const {
+        const Point3 bound = minimizedPoint<K>(p);
+        for (size_t j = 0; j < count; ++j) {
+            const Point3 other = minimizedPoint<K>(point(span[j]));
+            limits_[j] = {std::max(other[0], bound[0]), std::max(other[1], bound[1]),
+                          std::max(other[2], bound[2])};
+            if (limits_[j] == bound) return false;
+        }
+        double box = (reference[0] - bound[0]) * (reference[1] - bound[1]) * (reference[2] - bound[2]);
+        contribution = box - staircase_.sweep(limits_, count, reference);
+        return true;
+    }
+
+    // Sweep along objective D-2: the strip up to the next point (or the
+    // reference) is covered down to the best value of objective D-1 seen so far
+    double calculate2D(std::uint32_t* span, size_t count) const {
+        constexpr size_t X = D - 2;
+        constexpr size_t Y = D - 1;
+        sortBy<X>(span, count);
+
+        double volume = 0.0;
+        double best_y = reference_[Y];
+        for (size_t i = 0; i < count; ++i) {
+            const double* current = point(span[i]);
+            if (gap<Mask, Y>(current[Y], best_y) > 0.0) {
+                best_y = current[Y];
+            }
+            double next_x = i + 1 < count ? point(span[i + 1])[X] : reference_[X];
+            volume += gap<Mask, X>(current[X], next_x) * gap<Mask, Y>(best_y, reference_[Y]);
+        }
+        return volume;
+    }
+
+    const double* values_;
+    const double* reference_;
+    size_t capacity_;
+    Point3* limits_;
+    mutable Staircase3D staircase_;
+};
+
+/**
+ * Same recursion with the dimension and the sense mask read at run time, for
+ * problem sizes without a compiled kernel.
+ *
+ * Slices of objective 0 are measured on a copy of the set the top level keeps,
+ * so their recursion does not reorder it. The set after each point therefore
+ * depends only on the points, and runParallel() can hand copies of it to a
+ * ThreadPool and add the slice volumes in order, matching run() bit for bit.
+ * The arena needs one region per objective.
+ */
+class GenericKernel {
+public:
+    GenericKernel(const double* values, const double* reference, size_t num_objectives, unsigned mask,
+                  size_t capacity)
+        : values_(values), reference_(reference), n_(num_objectives), mask_(mask), capacity_(capacity) {}
+
+    double run(std::uint32_t* span, size_t num_points) const {
+        size_t count = 0;
+        for (size_t p = 0; p < num_points; ++p) {
+            bool inside = true;
+            for (size_t i = 0; i < n_ && inside; ++i) {
+                inside = gap(point(p)[i], reference_[i], i) > 0.0;
+            }
+            if (inside) insert(span, count, static_cast<std::uint32_t>(p), 0);
+        }
+        if (count == 0) return 0.0;
+        if (n_ == 1) return gap(point(span[0])[0], reference_[0], 0);
+        return hso(span, count, 0, span + capacity_);
+    }
+
+    double runParallel(std::uint32_t* span, size_t num_points, ThreadPool& pool) const {
+        if (n_ < 3) return run(span, num_points);
+
+        size_t count = 0;
+        for (size_t p = 0; p < num_points; ++p) {
+            bool inside = true;
+            for (size_t i = 0; i < n_ && inside; ++i) {
+                inside = gap(point(p)[i], reference_[i], i) > 0.0;
+            }
+            if (inside) insert(span, count, static_cast<std::uint32_t>(p), 0);
+        }
+        if (count == 0) return 0.0;
+        sortBy(span, count, 0);
+
+        // Slices below objective 0 need n-2 regions per worker
+        std::vector<std::vector<std::uint32_t>> arenas(pool.size(),
+                                                       std::vector<std::uint32_t>((n_ - 2) * capacity_));
+        std::uint32_t* scratch = span + capacity_;
+        const size_t round = pool.size() * TASKS_PER_THREAD;
+        std::vector<std::uint32_t> sets;  // Set of each slice of the round, back to back
+        std::vector<size_t> offsets(round + 1);
+        std::vector<double> depths(round);
+        std::vector<double> slices(round);
+
+        double volume = 0.0;
+        size_t slice_count = 0;
+        for (size_t first = 0; first < count; first += round) {
+            const size_t tasks = std::min(round, count - first);
+            sets.clear();
+            for (size_t k = 0; k < tasks; ++k) {
+                const size_t i = first + k;
+                insert(scratch, slice_count, span[i], 1);
+                double next = i + 1 < count ? point(span[i + 1])[0] : reference_[0];
+                depths[k] = gap(point(span[i])[0], next, 0);
+                offsets[k] = sets.size();
+                if (depths[k] > 0.0) sets.insert(sets.end(), scratch, scratch + slice_count);
+            }
+            offsets[tasks] = sets.size();
+
+            pool.run(tasks, [&](size_t k, size_t worker) {
+                if (depths[k] > 0.0) {
+                    slices[k] = slice(sets.data() + offsets[k], offsets[k + 1] - offsets[k], arenas[worker].data());
+                }
+            });
+
+            for (size_t k = 0; k < tasks; ++k) {
+                if (depths[k] > 0.0) volume += depths[k] * slices[k];
+            }
+        }
+        return volume;
+    }
+
+private:
+    // Volume of a slice of objective 0, measured on a copy of its members
+    double slice(const std::uint32_t* members, size_t count, std::uint32_t* arena) const {
+        std::copy(members, members + count, arena);
+        return hso(arena, count, 1, arena + capacity_);
+    }
+
+    const double* point(size_t index) const { return values_ + index * n_; }
+    bool maximized(size_t objective) const { return (mask_ >> objective) & 1u; }
+    double gap(double value, double worse, size_t objective) const {
+        return maximized(objective) ? value - worse : worse - value;
+    }
+
+    bool weaklyDominates(const double* a, const double* b, size_t k) const {
+        for (size_t i = k; i < n_; ++i) {
+            if (maximized(i) ? a[i] < b[i] : a[i] > b[i]) return false;
+        }
+        return true;
+    }
+
+    void insert(std::uint32_t* span, size_t& count, std::uint32_t index, size_t k) const {
+        const double* candidate = point(index);
+        for (size_t j = 0; j < count; ++j) {
+            if (weaklyDominates(point(span[j]), candidate, k)) return;
+        }
+        size_t kept = 0;
+        for (size_t j = 0; j < count; ++j) {
+            if (!weaklyDominates(candidate, point(span[j]), k)) {
+                span[kept++] = span[j];
+            }
+        }
+        span[kept] = index;
+        count = kept + 1;
+    }
+
+    void sortBy(std::uint32_t* span, size_t count, size_t k) const {
+        const double* values = values_;
+        const size_t n = n_;
+        if (maximized(k)) {
+            std::sort(span, span + count, [values, n, k](std::uint32_t a, std::uint32_t b) {
+                return values[a * n + k] > values[b * n + k];
+            });
+        } else {
+            std::sort(span, span + count, [values, n, k](std::uint32_t a, std::uint32_t b) {
+                return values[a * n + k] < values[b * n + k];
+            });
+        }
+    }
+
+    double hso(std::uint32_t* span, size_t count, size_t k, std::uint32_t* scratch) const {
+        if (k == n_ - 2) return calculate2D(span, count);
+
+        sortBy(span, count, k);
+        double volume = 0.0;
+        size_t slice_count = 0;
+        for (size_t i = 0; i < count; ++i) {
+            insert(scratch, slice_count, span[i], k + 1);
+
+            double next = i + 1 < count ? point(span[i + 1])[k] : reference_[k];
+            double depth = gap(point(span[i])[k], next, k);
+            if (depth > 0.0) {
+                volume += depth * (k == 0 ? slice(scratch, slice_count, scratch + capacity_)
+                                          : hso(scratch, slice_count, k + 1, scratch + capacity_));
+            }
+        }
+        return volume;
+    }
+
+    double calculate2D(std::uint32_t* span, size_t count) const {
+        const size_t x = n_ - 2;
+        const size_t y = n_ - 1;
+        sortBy(span, count, x);
+
+        double volume = 0.0;
+        double best_y = reference_[y];
+        for (size_t i = 0; i < count; ++i) {
+            const double* current = point(span[i]);
+            if (gap(current[y], best_y, y) > 0.0) {
+                best_y = current[y];
+            }
+            double next_x = i + 1 < count ? point(span[i + 1])[x] : reference_[x];
+            volume += gap(current[x], next_x, x) * gap(best_y, reference_[y], y);
+        }
+        return volume;
+    }
+
+    const double* values_;
+    const double* reference_;
+    size_t n_;
+    unsigned mask_;
+    size_t capacity_;
+};
+
+// Runs the kernel on the calling thread, or on the pool when one is given
+template <size_t D, unsigned Mask>
+double runKernel(const double* values, size_t num_points, const double* reference, std::uint32_t* arena,
+                 Point3* limits, ThreadPool* pool) {
+    HsoKernel<D, Mask> kernel(values, reference, num_points, limits);
+    return pool ? kernel.runParallel(arena, num_points, *pool) : kernel.run(arena, num_points);
 }
 
-bool HypervolumeCalculator::Point::isDominatedBy(const Point& other, size_t k) const {
-    return other.dominates(*this, k);
+// Selects the compiled kernel for a sense mask of D objectives
+template <size_t D, unsigned... Masks>
+double dispatch(unsigned mask, const double* values, size_t num_points, const double* reference,
+                std::uint32_t* arena, Point3* limits, ThreadPool* pool, std::integer_sequence<unsigned, Masks...>) {
+    using Kernel = double (*)(const double*, size_t, const double*, std::uint32_t*, Point3*, ThreadPool*);
+    static constexpr Kernel kernels[] = {&runKernel<D, Masks>...};
+    return kernels[mask](values, num_points, reference, arena, limits, pool);
 }
 
-// Main calculate function
-double HypervolumeCalculator::calculate(
+template <size_t D>
+double dispatch(unsigned mask, const double* values, size_t num_points, const double* reference,
+                std::uint32_t* arena, Point3* limits, ThreadPool* pool) {
+    return dispatch<D>(mask, values, num_points, reference, arena, limits, pool,
+                       std::make_integer_sequence<unsigned, (1u << D)>());
+}
+
+} // namespace
+
+HypervolumeCalculator::Workspace& HypervolumeCalculator::workspace() {
+    thread_local Workspace instance;
+    return instance;
+}
+
+// Flattens the objectives of the solutions into the workspace and returns the
+// reference point to measure them against
+std::vector<double> HypervolumeCalculator::flattenSolutions(
     const std::vector<Solution>& solutions, 
     const std::vector<double>& reference_point
 ) {
-    if (solutions.empty()) return 0.0;
-    
-    // Convert solutions to points
-    std::vector<Point> points;
-    points.reserve(solutions.size());
-    for (const auto& solution : solutions) {
-        points.emplace_back(solution);
-    }
-    
-    // Check for dimensionality mismatch
+    // Flatten the objective vectors into the workspace
     size_t num_objectives = reference_point.size();
-    for (const auto& point : points) {
-        if (point.objectives.size() != num_objectives) {
+    std::vector<double>& values = workspace().values;
+    values.clear();
+    for (const auto& solution : solutions) {
+        const std::vector<double> objectives = solution.getObjectives();
+        if (objectives.size() != num_objectives) {
             throw std::runtime_error("Dimensions mismatch between solutions and reference point");
         }
+        values.insert(values.end(), objectives.begin(), objectives.end());
     }
+    const size_t num_points = solutions.size();
+    auto maximized = [](size_t objective) { return (DEFAULT_MAXIMIZE_MASK >> objective) & 1u; };
     
     // Verify if reference point is valid (not dominated by any solution)
     // For mixed objectives, the reference point validity check needs to consider
     // direction of optimization for each objective
     bool reference_is_valid = true;
-    for (const auto& point : points) {
+    for (size_t p = 0; p < num_points; ++p) {
+        const double* point = &values[p * num_objectives];
         bool point_dominates_reference = true;
         for (size_t i = 0; i < num_objectives; ++i) {
-            if (i == 2) { // Maximization objective (attractions)
+            if (maximized(i)) { // Maximization objective (attractions)
                 // For maximization, reference should be worse (lower) than the point
-                if (point.objectives[i] <= reference_point[i]) {
+                if (point[i] <= reference_point[i]) {
                     point_dominates_reference = false;
                     break;
                 }
             } else { // Minimization objectives (cost, time)
                 // For minimization, reference should be worse (higher) than the point
-                if (point.objectives[i] >= reference_point[i]) {
+                if (point[i] >= reference_point[i]) {
                     point_dominates_reference = false;
                     break;
                 }
@@ -91,11 +683,11 @@ double HypervolumeCalculator::calculate(
     std::vector<double> adjusted_reference(num_objectives);
     if (!reference_is_valid) {
         for (size_t i = 0; i < num_objectives; ++i) {
-            if (i == 2) { // Maximization objective (attractions)
+            if (maximized(i)) { // Maximization objective (attractions)
                 // For maximization, find the maximum value and make reference worse (lower)
                 double max_value = std::numeric_limits<double>::lowest();
-                for (const auto& point : points) {
-                    max_value = std::max(max_value, point.objectives[i]);
+                for (size_t p = 0; p < num_points; ++p) {
+                    max_value = std::max(max_value, values[p * num_objectives + i]);
                 }
                 // Subtract a margin to ensure it's worse than all points
                 double margin = std::max(0.1 * std::abs(max_value), 1.0);
@@ -103,8 +695,8 @@ double HypervolumeCalculator::calculate(
             } else { // Minimization objectives (cost, time)
                 // For minimization, find the minimum value and make reference worse (higher)
                 double min_value = std::numeric_limits<double>::max();
-                for (const auto& point : points) {
-                    min_value = std::min(min_value, point.objectives[i]);
+                for (size_t p = 0; p < num_points; ++p) {
+                    min_value = std::min(min_value, values[p * num_objectives + i]);
                 }
                 // Add a margin to ensure it's worse than all points
                 double margin = std::max(0.1 * std::abs(min_value), 1.0);
@@ -115,303 +707,347 @@ double HypervolumeCalculator::calculate(
         adjusted_reference = reference_point;
     }
     
-    // Call the recursive HSO algorithm with the adjusted reference point
-    double volume = hso(std::move(points), 0, num_objectives, adjusted_reference).volume;
-    
-    return volume;
+    return adjusted_reference;
 }
 
-// HSO algorithm as described in While et al. (2006)
-// "A Faster Algorithm for Calculating Hypervolume"
-HypervolumeCalculator::HVResult HypervolumeCalculator::hso(
-    std::vector<Point> points, 
-    size_t k, 
-    size_t n, 
+// Main calculate function
+double HypervolumeCalculator::calculate(
+    const std::vector<Solution>& solutions, 
     const std::vector<double>& reference_point
 ) {
-    HVResult result;
-    
-    // Base case: k = n-2 means we have 2 objectives left (2D case)
-    if (k == n - 2) {
-        // Filter dominated points before calculating 2D hypervolume
-        points = filterDominated(points, k);
-        result.volume = calculate2D(points, 
-                                   {reference_point[n-2], reference_point[n-1]},
-                                   n-2 == 2 || n-1 == 2); // Check if either dimension is the maximization objective
-        result.points = std::move(points);
-        return result;
-    }
-    
-    // Filter dominated points in current dimension and above
-    points = filterDominated(points, k);
+    if (solutions.empty()) return 0.0;
     
-    // If no points left after filtering, return zero volume
-    if (points.empty()) {
-        result.volume = 0.0;
-        return result;
-    }
+    // Call the recursive HSO algorithm with the adjusted reference point
+    const std::vector<double> reference = flattenSolutions(solutions, reference_point);
+    return calculate(workspace().values.data(), solutions.size(), reference.size(), reference.data());
+}
+
+double HypervolumeCalculator::calculate(
+    const std::vector<std::vector<double>>& objective_vectors, 
+    const std::vector<double>& reference_point,
+    unsigned maximize_mask
+) {
+    if (objective_vectors.empty()) return 0.0;
     
-    // Sort points by kth objective
-    // For minimization (objectives 0, 1): ascending order 
-    // For maximization (objective 2): descending order
-    if (k == 2) { // Maximization objective
-        std::sort(points.begin(), points.end(), 
-                [k](const Point& a, const Point& b) {
-                    return a.objectives[k] > b.objectives[k]; // Descending for maximization
-                });
-    } else { // Minimization objectives
-        std::sort(points.begin(), points.end(), 
-                [k](const Point& a, const Point& b) {
-                    return a.objectives[k] < b.objectives[k]; // Ascending for minimization
-                });
+    size_t num_objectives = reference_point.size();
+    std::vector<double>& values = workspace().values;
+    values.clear();
+    for (const auto& point : objective_vectors) {
+        if (point.size() != num_objectives) {
+            throw std::runtime_error("Dimensions mismatch between points and reference point");
+        }
+        values.insert(values.end(), point.begin(), point.end());
     }
     
-    // Calculate hypervolume by slicing
-    // This follows the HSO algorithm in While et al. (2006)
-    double volume = 0.0;
-    double prev_slice = reference_point[k];
+    return calculate(values.data(), objective_vectors.size(), num_objectives, reference_point.data(),
+                     maximize_mask);
+}
+
+double HypervolumeCalculator::calculate(
+    const double* values,
+    size_t num_points,
+    size_t num_objectives,
+    const double* reference_point,
+    unsigned maximize_mask
+) {
+    return measure(values, num_points, num_objectives, reference_point, maximize_mask, 1);
+}
+
+double HypervolumeCalculator::calculateParallel(
+    const std::vector<std::vector<double>>& objective_vectors, 
+    const std::vector<double>& reference_point,
+    unsigned maximize_mask,
+    size_t threads
+) {
+    if (objective_vectors.empty()) return 0.0;
     
-    for (size_t i = 0; i < points.size(); ++i) {
-        // Current point defines the bound of the current slice
-        double current_slice = points[i].objectives[k];
-        
-        // Skip if point doesn't contribute to hypervolume in this dimension
-        // For minimization: skip if point's value >= reference point
-        // For maximization: skip if point's value <= reference point
-        if (k == 2) { // Maximization
-            if (current_slice <= reference_point[k]) continue;
-        } else { // Minimization
-            if (current_slice >= reference_point[k]) continue;
-        }
-        
-        // Calculate the height of the slice
-        // For minimization: height = previous_value - current_value
-        // For maximization: height = current_value - previous_value
-        double slice_height;
-        if (k == 2) { // Maximization
-            slice_height = current_slice - prev_slice;
-        } else { // Minimization
-            slice_height = prev_slice - current_slice;
+    size_t num_objectives = reference_point.size();
+    std::vector<double>& values = workspace().values;
+    values.clear();
+    for (const auto& point : objective_vectors) {
+        if (point.size() != num_objectives) {
+            throw std::runtime_error("Dimensions mismatch between points and reference point");
         }
-        
-        // Create a sublist of points for this slice (all points from i onwards)
-        std::vector<Point> slice_points(points.begin() + i, points.end());
-        
-        // Process the next dimension recursively
-        HVResult subresult = hso(slice_points, k + 1, n, reference_point);
-        
-        // Multiply the (n-1)-dimensional volume by the height of the slice
-        volume += slice_height * subresult.volume;
-        
-        // Update for next slice
-        prev_slice = current_slice;
+        values.insert(values.end(), point.begin(), point.end());
     }
     
-    result.volume = volume;
-    result.points = std::move(points);
-    return result;
+    return calculateParallel(values.data(), objective_vectors.size(), num_objectives, reference_point.data(),
+                             maximize_mask, threads);
 }
 
-// Alternative slice implementation (not used directly, but kept for reference)
-double HypervolumeCalculator::slice(
-    std::vector<Point>& points, 
-    size_t k, 
-    size_t n, 
-    const std::vector<double>& reference_point
+double HypervolumeCalculator::calculateParallel(
+    const double* values,
+    size_t num_points,
+    size_t num_objectives,
+    const double* reference_point,
+    unsigned maximize_mask,
+    size_t threads
 ) {
-    // Filter dominated points
-    points = filterDominated(points, k);
-    
-    // If no points left, return zero volume
-    if (points.empty()) return 0.0;
-    
-    // If we're down to 2 dimensions, use the optimized 2D calculation
-    if (k == n - 2) {
-        return calculate2D(points, 
-                         {reference_point[n-2], reference_point[n-1]}, 
-                         n-2 == 2 || n-1 == 2); // Check if either dimension is for maximization
+    return measure(values, num_points, num_objectives, reference_point, maximize_mask,
+                   ThreadPool::resolve(threads));
+}
+
+double HypervolumeCalculator::measure(
+    const double* values,
+    size_t num_points,
+    size_t num_objectives,
+    const double* reference_point,
+    unsigned maximize_mask,
+    size_t threads
+) {
+    const size_t n = num_objectives;
+    if (num_points == 0 || n == 0) return 0.0;
+    if (n > MAX_OBJECTIVES) {
+        throw std::invalid_argument("Too many objectives for hypervolume calculation");
+    }
+    if (num_points > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("Too many points for hypervolume calculation");
+    }
+    if (n < MAX_OBJECTIVES) {
+        maximize_mask &= (1u << n) - 1;
     }
     
-    // Sort points by kth objective (ascending for min, descending for max)
-    if (k == 2) { // Maximization
-        std::sort(points.begin(), points.end(), 
-                [k](const Point& a, const Point& b) {
-                    return a.objectives[k] > b.objectives[k]; 
-                });
-    } else { // Minimization
-        std::sort(points.begin(), points.end(), 
-                [k](const Point& a, const Point& b) {
-                    return a.objectives[k] < b.objectives[k]; 
-                });
+    // One span of num_points indices per recursion level (objectives 0 ... n-2,
+    // plus the copy the generic kernel slices) and room for as many clipped
+    // points for the 3D sweeps
+    Workspace& buffers = workspace();
+    const size_t levels = n <= 4 ? std::max<size_t>(n - 1, 1) : n;
+    if (buffers.indices.size() < num_points * levels) {
+        buffers.indices.resize(num_points * levels);
+    }
+    if (n >= 3 && buffers.limits.size() < num_points) {
+        buffers.limits.resize(num_points);
     }
+    std::uint32_t* arena = buffers.indices.data();
+    Point3* limits = buffers.limits.data();
     
-    // Calculate volume by slicing
-    double volume = 0.0;
-    double prev_slice = reference_point[k];
+    // Two and three objectives are single O(n log n) sweeps and stay on this thread
+    std::optional<ThreadPool> pool;
+    if (threads > 1 && n >= 4 && num_points >= PARALLEL_MIN_POINTS) {
+        pool.emplace(threads);
+    }
+    ThreadPool* slices = pool ? &*pool : nullptr;
     
-    for (size_t i = 0; i < points.size(); ++i) {
-        double current_slice = points[i].objectives[k];
-        
-        // Skip if point doesn't contribute
-        if (k == 2) { // Maximization
-            if (current_slice <= reference_point[k]) continue;
-        } else { // Minimization
-            if (current_slice >= reference_point[k]) continue;
+    switch (n) {
+        case 2: return dispatch<2>(maximize_mask, values, num_points, reference_point, arena, limits, nullptr);
+        case 3: return dispatch<3>(maximize_mask, values, num_points, reference_point, arena, limits, nullptr);
+        case 4: return dispatch<4>(maximize_mask, values, num_points, reference_point, arena, limits, slices);
+        default: {
+            GenericKernel kernel(values, reference_point, n, maximize_mask, num_points);
+            return slices ? kernel.runParallel(arena, num_points, *slices) : kernel.run(arena, num_points);
         }
-        
-        // Calculate slice height
-        double slice_height;
-        if (k == 2) { // Maximization
-            slice_height = current_slice - prev_slice;
-        } else { // Minimization
-            slice_height = prev_slice - current_slice;
-        }
-        
-        // Create a sublist for the next dimension
-        std::vector<Point> slice_points(points.begin() + i, points.end());
-        
-        // Process next dimension
-        double subvolume = slice(slice_points, k + 1, n, reference_point);
-        
-        // Accumulate volume
-        volume += slice_height * subvolume;
-        
-        // Update for next slice
-        prev_slice = current_slice;
     }
+}
+
+std::vector<double> HypervolumeCalculator::contributions(
+    const std::vector<Solution>& solutions, 
+    const std::vector<double>& reference_point
+) {
+    std::vector<double> result(solutions.size(), 0.0);
+    if (solutions.empty()) return result;
     
-    return volume;
+    const std::vector<double> reference = flattenSolutions(solutions, reference_point);
+    contributions(workspace().values.data(), solutions.size(), reference.size(), reference.data(),
+                  result.data());
+    return result;
 }
 
-// Special case calculation for 2D hypervolume
-// The isMaximization parameter indicates if the second dimension is to be maximized
-double HypervolumeCalculator::calculate2D(
-    const std::vector<Point>& points, 
+std::vector<double> HypervolumeCalculator::contributions(
+    const std::vector<std::vector<double>>& objective_vectors, 
     const std::vector<double>& reference_point,
-    bool isMaximization
+    unsigned maximize_mask
 ) {
-    // If no points, return zero
-    if (points.empty()) return 0.0;
+    std::vector<double> result(objective_vectors.size(), 0.0);
+    if (objective_vectors.empty()) return result;
     
-    // Make a local copy of points for sorting
-    std::vector<Point> sorted_points = points;
-    
-    // Sort points by first dimension
-    // For dim0, always minimize (cost, time)
-    std::sort(sorted_points.begin(), sorted_points.end(), 
-              [](const Point& a, const Point& b) {
-                  return a.objectives[0] < b.objectives[0];
-              });
+    size_t num_objectives = reference_point.size();
+    std::vector<double>& values = workspace().values;
+    values.clear();
+    for (const auto& point : objective_vectors) {
+        if (point.size() != num_objectives) {
+            throw std::runtime_error("Dimensions mismatch between points and reference point");
+        }
+        values.insert(values.end(), point.begin(), point.end());
+    }
     
-    // Calculate 2D volume
-    double volume = 0.0;
-    double prev_x = reference_point[0];
-    double best_y = reference_point[1]; // Start with reference (worst) value
+    contributions(values.data(), objective_vectors.size(), num_objectives, reference_point.data(),
+                  result.data(), maximize_mask);
+    return result;
+}
+
+void HypervolumeCalculator::contributions(
+    const double* values,
+    size_t num_points,
+    size_t num_objectives,
+    const double* reference_point,
+    double* result,
+    unsigned maximize_mask
+) {
+    const size_t n = num_objectives;
+    std::fill(result, result + num_points, 0.0);
+    if (num_points == 0 || n == 0) return;
+    if (n > MAX_OBJECTIVES) {
+        throw std::invalid_argument("Too many objectives for hypervolume calculation");
+    }
+    if (num_points > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("Too many points for hypervolume calculation");
+    }
     
-    for (const auto& point : sorted_points) {
-        double x = point.objectives[0];
-        double y = point.objectives[1];
-        
-        // Skip points that don't contribute
-        // For both dims being minimization:
-        //   Skip if x >= ref_x or y >= ref_y
-        // If dim1 is maximization:
-        //   Skip if x >= ref_x or y <= ref_y
-        if (!isMaximization) {
-            if (x >= reference_point[0] || y >= reference_point[1]) continue;
-        } else {
-            if (x >= reference_point[0] || y <= reference_point[1]) continue;
+    // Work on a copy with every objective turned into minimization; only points
+    // strictly inside the reference box dominate any volume, and only they can
+    // take volume away from the others
+    Workspace& buffers = workspace();
+    std::vector<double> reference(reference_point, reference_point + n);
+    for (size_t i = 0; i < n; ++i) {
+        if ((maximize_mask >> i) & 1u) reference[i] = -reference[i];
+    }
+    std::vector<double>& oriented = buffers.oriented;
+    oriented.resize(num_points * n);
+    std::vector<std::uint32_t> inside;
+    inside.reserve(num_points);
+    for (size_t p = 0; p < num_points; ++p) {
+        double* point = &oriented[p * n];
+        bool encloses = true;
+        for (size_t i = 0; i < n; ++i) {
+            point[i] = (maximize_mask >> i) & 1u ? -values[p * n + i] : values[p * n + i];
+            encloses = encloses && point[i] < reference[i];
         }
-        
-        // Update the best y seen so far
-        // For minimization: best is min value
-        // For maximization: best is max value
-        bool is_better;
-        if (!isMaximization) {
-            is_better = y < best_y;
-        } else {
-            is_better = y > best_y;
+        if (encloses) inside.push_back(static_cast<std::uint32_t>(p));
+    }
+    auto point = [&oriented, n](size_t index) { return &oriented[index * n]; };
+    
+    // Two objectives, mutually non-dominated points: after sorting by the first
+    // objective the second strictly decreases, and each point owns the rectangle
+    // between its neighbours
+    if (n == 2) {
+        std::sort(inside.begin(), inside.end(), [&point](std::uint32_t a, std::uint32_t b) {
+            return point(a)[0] < point(b)[0] || (point(a)[0] == point(b)[0] && point(a)[1] < point(b)[1]);
+        });
+        bool staircase = true;
+        for (size_t j = 1; j < inside.size() && staircase; ++j) {
+            staircase = point(inside[j - 1])[0] < point(inside[j])[0] && point(inside[j - 1])[1] > point(inside[j])[1];
         }
-        
-        if (is_better) {
-            // Calculate area contribution
-            double width = prev_x - x; // Always prev - current for minimization in dim0
-            double height;
-            
-            if (!isMaximization) {
-                height = reference_point[1] - y; // ref - current for minimization
-            } else {
-                height = y - reference_point[1]; // current - ref for maximization
+        if (staircase) {
+            for (size_t j = 0; j < inside.size(); ++j) {
+                const double* current = point(inside[j]);
+                double right = j + 1 < inside.size() ? point(inside[j + 1])[0] : reference[0];
+                double top = j > 0 ? point(inside[j - 1])[1] : reference[1];
+                result[inside[j]] = (right - current[0]) * (top - current[1]);
             }
-            
-            volume += width * height;
-            best_y = y;
-            prev_x = x;
+            return;
         }
     }
     
-    return volume;
+    // General case: each point against the others inside the box
+    for (std::uint32_t p : inside) {
+        result[p] = clippedContribution(point(p), oriented.data(), inside.data(), inside.size(), p, n,
+                                        reference.data());
+    }
 }
 
-// Filter dominated points based on dominance in objectives [k...n]
-// As per While et al. (2006), this step is crucial for efficiency
-std::vector<HypervolumeCalculator::Point> HypervolumeCalculator::filterDominated(
-    const std::vector<Point>& points, 
-    size_t k
+double HypervolumeCalculator::contribution(
+    const double* point,
+    const double* values,
+    size_t num_points,
+    size_t num_objectives,
+    const double* reference_point,
+    unsigned maximize_mask
 ) {
-    // If less than 2 points, nothing can be dominated
-    if (points.size() < 2) return points;
+    const size_t n = num_objectives;
+    if (n == 0) return 0.0;
+    if (n > MAX_OBJECTIVES) {
+        throw std::invalid_argument("Too many objectives for hypervolume calculation");
+    }
+    if (num_points >= std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("Too many points for hypervolume calculation");
+    }
     
-    std::vector<Point> non_dominated;
-    non_dominated.reserve(points.size());
+    auto minimized = [maximize_mask](double value, size_t objective) {
+        return (maximize_mask >> objective) & 1u ? -value : value;
+    };
+    std::vector<double> reference(n);
+    std::vector<double> bound(n);
+    for (size_t i = 0; i < n; ++i) {
+        reference[i] = minimized(reference_point[i], i);
+        bound[i] = minimized(point[i], i);
+        if (bound[i] >= reference[i]) return 0.0;
+    }
     
-    for (const auto& point : points) {
-        bool is_dominated = false;
-        
-        // Check if this point is dominated by any points already in non_dominated
-        for (const auto& other : non_dominated) {
-            if (point.isDominatedBy(other, k)) {
-                is_dominated = true;
-                break;
-            }
-        }
-        
-        if (!is_dominated) {
-            // Before adding, remove any points in non_dominated that this point dominates
-            auto it = std::remove_if(non_dominated.begin(), non_dominated.end(),
-                                    [&point, k](const Point& other) {
-                                        return other.isDominatedBy(point, k);
-                                    });
-            non_dominated.erase(it, non_dominated.end());
-            
-            // Add this point
-            non_dominated.push_back(point);
+    // Only the points inside the reference box can take volume from it
+    Workspace& buffers = workspace();
+    std::vector<double>& oriented = buffers.oriented;
+    oriented.resize(num_points * n);
+    std::vector<std::uint32_t> inside;
+    inside.reserve(num_points);
+    for (size_t p = 0; p < num_points; ++p) {
+        bool encloses = true;
+        for (size_t i = 0; i < n; ++i) {
+            oriented[p * n + i] = minimized(values[p * n + i], i);
+            encloses = encloses && oriented[p * n + i] < reference[i];
         }
+        if (encloses) inside.push_back(static_cast<std::uint32_t>(p));
     }
     
-    return non_dominated;
+    return clippedContribution(bound.data(), oriented.data(), inside.data(), inside.size(),
+                               std::numeric_limits<std::uint32_t>::max(), n, reference.data());
 }
 
-// Calculate exclusive volume contribution of a point
-double HypervolumeCalculator::exclusiveVolume(
-    const Point& point, 
-    const std::vector<Point>& other_points,
-    const std::vector<double>& reference_point
+// While et al. (WFG): the contribution of a point is its box minus the volume of
+// the other points clipped to that box. The clipped set is reduced to its
+// non-dominated members before it is measured by the dimension kernels.
+double HypervolumeCalculator::clippedContribution(
+    const double* bound,
+    const double* points,
+    const std::uint32_t* members,
+    size_t count,
+    std::uint32_t self,
+    size_t n,
+    const double* reference
 ) {
-    std::vector<Point> all_points = other_points;
-    all_points.push_back(point);
-    
-    // For mixed objectives, we need to check if any dimension is maximization
-    bool has_max_objective = reference_point.size() > 2; // In our case, with 3 objectives, the 3rd is maximization
-    
-    // Calculate total volume with all points
-    double total_volume = calculate2D(all_points, reference_point, has_max_objective);
+    std::vector<double>& clipped = workspace().clipped;
+    if (clipped.size() < count * n) {
+        clipped.resize(count * n);
+    }
+    auto weaklyDominates = [n](const double* a, const double* b) {
+        for (size_t i = 0; i < n; ++i) {
+            if (a[i] > b[i]) return false;
+        }
+        return true;
+    };
     
-    // Calculate volume without the specific point
-    double volume_without_point = calculate2D(other_points, reference_point, has_max_objective);
+    size_t kept_count = 0;
+    for (size_t m = 0; m < count; ++m) {
+        if (members[m] == self) continue;
+        const double* other = points + static_cast<size_t>(members[m]) * n;
+        double* limit = &clipped[kept_count * n];
+        for (size_t i = 0; i < n; ++i) {
+            limit[i] = std::max(other[i], bound[i]);
+        }
+        if (std::equal(limit, limit + n, bound)) {
+            return 0.0;  // The other point weakly dominates this one
+        }
+        
+        bool dominated = false;
+        for (size_t j = 0; j < kept_count && !dominated; ++j) {
+            dominated = weaklyDominates(&clipped[j * n], limit);
+        }
+        if (dominated) continue;
+        size_t kept = 0;
+        for (size_t j = 0; j < kept_count; ++j) {
+            if (!weaklyDominates(limit, &clipped[j * n])) {
+                if (kept != j) std::copy_n(&clipped[j * n], n, &clipped[kept * n]);
+                ++kept;
+            }
+        }
+        if (kept != kept_count) std::copy_n(limit, n, &clipped[kept * n]);
+        kept_count = kept + 1;
+    }
     
-    // The exclusive contribution is the difference
-    return total_volume - volume_without_point;
+    double box = 1.0;
+    for (size_t i = 0; i < n; ++i) {
+        box *= reference[i] - bound[i];
+    }
+    return box - calculate(clipped.data(), kept_count, n, reference, 0);
 }
 
 // HypervolumeMetrics implementation
@@ -426,29 +1062,15 @@ std::vector<double> HypervolumeMetrics::calculateContributions(
     const std::vector<Solution>& solutions, 
     const std::vector<double>& reference_point
 ) {
-    std::vector<double> contributions(solutions.size(), 0.0);
-    
-    // Calculate total hypervolume
-    double total_volume = calculateHypervolume(solutions, reference_point);
-    
-    // Calculate hypervolume without each solution
-    for (size_t i = 0; i < solutions.size(); ++i) {
-        std::vector<Solution> subset = solutions;
-        subset.erase(subset.begin() + i);
-        
-        double volume_without_i = calculateHypervolume(subset, reference_point);
-        contributions[i] = total_volume - volume_without_i;
-    }
-    
-    return contributions;
+    return HypervolumeCalculator::contributions(solutions, reference_point);
 }
 
 std::vector<double> HypervolumeMetrics::calculateExclusiveContributions(
     const std::vector<Solution>& solutions, 
     const std::vector<double>& reference_point
 ) {
-    // This is equivalent to calculateContributions for hypervolume
-    return calculateContributions(solutions, reference_point);
+    // The contribution of a solution is the volume it alone dominates
+    return HypervolumeCalculator::contributions(solutions, reference_point);
 }
 
 } // namespace utils
@@ -1,7 +1,7 @@
 #include "nsga2-base.hpp"
 #include "utils.hpp"
+#include "results-format.hpp"
 #include <iostream>
-#include <fstream>
 #include <iomanip>
 #include <chrono>
 #include <string>
@@ -126,72 +126,6 @@ void printSolution(const Solution& solution, size_t index) {
     std::cout << utils::Transport::formatTime(day_start_time + route.getTotalTime()) << " - Fim do dia\n";
 }
 
-void exportResults(const std::vector<Solution>& solutions, const std::string& filename) {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Erro ao criar arquivo: " + filename);
-    }
-
-    file << "Solucao;CustoTotal;TempoTotal;NumAtracoes;NumBairros;HoraInicio;HoraFim;Bairros;Sequencia;TemposChegada;TemposPartida;ModosTransporte\n";
-    
-    for (size_t i = 0; i < solutions.size(); ++i) {
-        const auto& solution = solutions[i];
-        const auto& objectives = solution.getObjectives();
-        const auto& route = solution.getRoute();
-        const auto& attractions = route.getAttractions();
-        const auto& modes = route.getTransportModes();
-        const auto& time_info = route.getTimeInfo();
-        
-        double start_time = 9 * 60; 
-        double end_time = start_time + route.getTotalTime();
-        
-        // Calculate unique neighborhoods
-        std::unordered_set<std::string> neighborhoods;
-        for (const auto* attraction : attractions) {
-            neighborhoods.insert(attraction->getNeighborhood());
-        }
-        
-        file << std::fixed << std::setprecision(COST_PRECISION);
-        file << (i + 1) << ";";
-        file << objectives[0] << ";";
-        file << objectives[1] << ";";
-        file << std::abs(static_cast<int>(objectives[2])) << ";";
-        file << neighborhoods.size() << ";";  // Number of neighborhoods
-        file << utils::Transport::formatTime(start_time) << ";";
-        file << utils::Transport::formatTime(end_time) << ";";
-        
-        // Neighborhood list
-        for (const auto& neighborhood : neighborhoods) {
-            file << neighborhood << "|";
-        }
-        file << ";";
-        
-        // Sequência de atrações
-        for (const auto* attraction : attractions) {
-            file << attraction->getName() << "|";
-        }
-        file << ";";
-        
-        // Tempos de chegada
-        for (size_t j = 0; j < time_info.size(); ++j) {
-            file << utils::Transport::formatTime(time_info[j].arrival_time) << "|";
-        }
-        file << ";";
-        
-        // Tempos de partida
-        for (size_t j = 0; j < time_info.size(); ++j) {
-            file << utils::Transport::formatTime(time_info[j].departure_time) << "|";
-        }
-        file << ";";
-        
-        // Modos de transporte
-        for (const auto& mode : modes) {
-            file << utils::Transport::getModeString(mode) << "|";
-        }
-        file << "\n";
-    }
-}
-
 int main() {
     std::vector<Solution> solutions; // Define outside the try block
 
@@ -234,6 +168,7 @@ int main() {
         params.max_generations = 100;
         params.crossover_rate = 0.9;
         params.mutation_rate = 0.1;
+        params.perf_counters = PERF_COUNTERS_COMPILED;
         
         try {
             std::cout << "Validando parâmetros...\n";
@@ -268,7 +203,70 @@ int main() {
             
             std::cout << "\n=== Resultados da Otimização ===\n";
             std::cout << "Tempo de execução: " << duration.count() << " segundos\n";
-            std::cout << "Soluções não-dominadas encontradas: " << solutions.size() << "\n\n";
+            std::cout << "Soluções não-dominadas encontradas: " << solutions.size() << "\n";
+            
+            const auto& run_info = nsga2.getRunInfo();
+            std::cout << "Gerações executadas: " << run_info.generations
+                      << " (parada: " << NSGA2Base::stopReasonName(run_info.stop_reason) << ")\n";
+            std::cout << "Avaliações: " << run_info.evaluations << "\n";
+            std::cout << "Arquivo externo: " << run_info.archive_size << " rotas não-dominadas\n";
+            
+            const auto& cache_stats = nsga2.getFitnessCacheStats();
+            std::cout << "Cache de avaliações: " << cache_stats.hits << "/" << cache_stats.lookups
+                      << " acertos (" << std::fixed << std::setprecision(1)
+                      << 100.0 * cache_stats.hitRate() << "%)\n\n";
+            
+            // Tempo por fase em milissegundos (mediana e p99 entre gerações)
+            const auto& profile = nsga2.getPhaseProfile();
+            if (profile.samples() > 0) {
+                std::cout << "Tempo por fase (total / mediana / p99 em ms):\n";
+                for (size_t p = 0; p < NUM_PHASES; ++p) {
+                    const auto phase = static_cast<Phase>(p);
+                    const auto stats = profile.stats(phase);
+                    if (stats.samples == 0) continue;
+                    std::cout << "  " << std::left << std::setw(15) << phaseName(phase) << std::right
+                              << std::fixed << std::setprecision(3)
+                              << 1e3 * stats.total << " / " << 1e3 * stats.median << " / "
+                              << 1e3 * stats.p99 << "\n";
+                }
+                
+                // Contadores de hardware por fase (somente com TOURIST_ENABLE_PERF_COUNTERS)
+                if (profile.countersEnabled()) {
+                    std::cout << "Contadores por fase (IPC / falhas de LLC / desvios mal previstos):\n";
+                    for (size_t p = 0; p < NUM_PHASES; ++p) {
+                        const auto phase = static_cast<Phase>(p);
+                        const auto totals = profile.counterTotals(phase);
+                        const auto cycles = totals[static_cast<size_t>(Counter::CYCLES)];
+                        if (cycles == 0) continue;
+                        std::cout << "  " << std::left << std::setw(15) << phaseName(phase) << std::right
+                                  << std::fixed << std::setprecision(2)
+                                  << static_cast<double>(totals[static_cast<size_t>(Counter::INSTRUCTIONS)]) / cycles
+                                  << " / " << totals[static_cast<size_t>(Counter::LLC_MISSES)]
+                                  << " / " << totals[static_cast<size_t>(Counter::BRANCH_MISSES)] << "\n";
+                    }
+                } else if (params.perf_counters) {
+                    std::cout << "Contadores de hardware indisponíveis: " << profile.countersError() << "\n";
+                }
+                
+                // Alocações por fase (somente com TOURIST_TRACK_ALLOCATIONS)
+                if (PhaseProfile::allocationsTracked()) {
+                    std::cout << "Alocações por fase (quantidade / KiB):\n";
+                    for (size_t p = 0; p < NUM_PHASES; ++p) {
+                        const auto phase = static_cast<Phase>(p);
+                        const auto allocations = profile.allocationTotals(phase);
+                        if (allocations.allocations == 0) continue;
+                        std::cout << "  " << std::left << std::setw(15) << phaseName(phase) << std::right
+                                  << allocations.allocations << " / " << std::fixed << std::setprecision(1)
+                                  << allocations.bytes / 1024.0 << "\n";
+                    }
+                    std::cout << "Pico de memória residente: " << std::setprecision(1)
+                              << profile.peakResident(profile.samples() - 1) / (1024.0 * 1024.0) << " MiB\n";
+                }
+                
+                const std::string profile_file = (results_dir / "nsga2-fases.json").string();
+                profile.writeReport(profile_file);
+                std::cout << "Relatório de fases: " << profile_file << "\n\n";
+            }
             
             if (solutions.empty()) {
                 std::cout << "Nenhuma solução válida encontrada. Considere relaxar as restrições.\n";
@@ -313,10 +311,16 @@ int main() {
                 printSolution(solutions[i], i);
             }
             
+            // Mesmos dados em CSV e no formato binário colunar
+            const auto table = ResultsTable::fromSolutions(solutions);
             const std::string output_file = (results_dir / "nsga2-resultados.csv").string();
-            exportResults(solutions, output_file);
+            ResultsFormat::writeCsv(table, output_file);
             std::cout << "\nResultados detalhados exportados para: " << output_file << "\n";
             
+            const std::string binary_file = (results_dir / "nsga2-resultados.bin").string();
+            ResultsFormat::write(table, binary_file);
+            std::cout << "Resultados em formato binário: " << binary_file << "\n";
+            
         } catch (const std::exception& e) {
             throw std::runtime_error(std::string("Erro durante a otimização: ") + e.what());
         }
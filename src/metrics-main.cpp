@@ -0,0 +1,200 @@
+// File: src/metrics-main.cpp
+// tourist_metrics: hypervolume, quality indicators and binary coverage of results files
+//
+// Usage: tourist_metrics [--threads N] [--output DIR] [PATH...]
+//   PATH    results files (.csv or .bin) or directories scanned for *resultados.csv
+//           (default: ../results)
+//   --output directory of metrics.csv, indicator-metrics.csv and binary-coverage-metrics.csv
+//           (default: the first directory given, or ../results)
+
+#include "front-metrics.hpp"
+#include <charconv>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace tourist;
+using utils::FrontMetrics;
+using utils::ResultFront;
+
+namespace {
+
+// Shortest text that reads back as the same double
+std::string formatNumber(double value) {
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    return std::string(buffer, result.ptr);
+}
+
+void printUsage() {
+    std::cerr << "Uso: tourist_metrics [--threads N] [--output DIR] [ARQUIVO|DIRETORIO...]\n";
+}
+
+void writeHypervolumes(const std::string& filename, const std::vector<ResultFront>& fronts,
+                       const std::vector<utils::FrontHypervolume>& volumes) {
+    std::ofstream file(filename);
+    if (!file.is_open()) throw std::runtime_error("Erro ao criar arquivo de métricas: " + filename);
+
+    file << "Algorithm,Hypervolume,RawHypervolume,SolutionCount,HypervolumeRatio\n";
+    for (size_t f = 0; f < fronts.size(); ++f) {
+        file << fronts[f].algorithm << ','
+             << formatNumber(volumes[f].normalized) << ','
+             << formatNumber(volumes[f].raw) << ','
+             << fronts[f].solutions << ','
+             << formatNumber(volumes[f].ratio) << '\n';
+    }
+}
+
+void writeIndicators(const std::string& filename, const std::vector<ResultFront>& fronts,
+                     const std::vector<utils::IndicatorValues>& indicators) {
+    std::ofstream file(filename);
+    if (!file.is_open()) throw std::runtime_error("Erro ao criar arquivo de métricas: " + filename);
+
+    // The multiplicative epsilon is left out: normalized objectives reach 0
+    file << "Algorithm,GD,IGD,IGDPlus,EpsilonAdditive,Spread\n";
+    for (size_t f = 0; f < fronts.size(); ++f) {
+        file << fronts[f].algorithm << ','
+             << formatNumber(indicators[f].gd) << ','
+             << formatNumber(indicators[f].igd) << ','
+             << formatNumber(indicators[f].igd_plus) << ','
+             << formatNumber(indicators[f].epsilon_additive) << ','
+             << formatNumber(indicators[f].spread) << '\n';
+    }
+}
+
+void writeCoverage(const std::string& filename, const std::vector<ResultFront>& fronts,
+                   const std::vector<double>& matrix) {
+    std::ofstream file(filename);
+    if (!file.is_open()) throw std::runtime_error("Erro ao criar arquivo de métricas: " + filename);
+
+    file << "Algorithm_A,Algorithm_B,Coverage_A_B,Solutions_A,Solutions_B\n";
+    const size_t count = fronts.size();
+    for (size_t a = 0; a < count; ++a) {
+        for (size_t b = 0; b < count; ++b) {
+            if (a == b) continue;
+            file << fronts[a].algorithm << ',' << fronts[b].algorithm << ','
+                 << formatNumber(matrix[a * count + b]) << ','
+                 << fronts[a].size() << ',' << fronts[b].size() << '\n';
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t threads = 0;
+    std::string output_dir;
+    std::vector<std::string> inputs;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if ((arg == "--threads" || arg == "--output") && i + 1 < argc) {
+            if (arg == "--threads") {
+                const std::string value = argv[++i];
+                const auto parsed = std::from_chars(value.data(), value.data() + value.size(), threads);
+                if (parsed.ec != std::errc() || parsed.ptr != value.data() + value.size()) {
+                    printUsage();
+                    return 1;
+                }
+            } else {
+                output_dir = argv[++i];
+            }
+        } else if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            printUsage();
+            return 1;
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+    if (inputs.empty()) inputs.push_back("../results");
+
+    try {
+        const auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::string> paths;
+        for (const auto& input : inputs) {
+            if (std::filesystem::is_directory(input)) {
+                if (output_dir.empty()) output_dir = input;
+                auto found = FrontMetrics::findResultFiles(input);
+                paths.insert(paths.end(), found.begin(), found.end());
+            } else {
+                paths.push_back(input);
+            }
+        }
+        if (output_dir.empty()) output_dir = "../results";
+        if (paths.empty()) {
+            std::cerr << "Nenhum arquivo de resultados encontrado\n";
+            return 1;
+        }
+
+        const std::vector<ResultFront> fronts = FrontMetrics::load(paths, threads);
+        const std::vector<double> reference_front = FrontMetrics::referenceFront(fronts);
+        const auto volumes = FrontMetrics::hypervolumes(fronts, reference_front, threads);
+        const auto indicators = FrontMetrics::indicators(fronts, reference_front, threads);
+        const auto coverage = FrontMetrics::coverageMatrix(fronts, threads);
+
+        const std::filesystem::path out(output_dir);
+        writeHypervolumes((out / "metrics.csv").string(), fronts, volumes);
+        writeIndicators((out / "indicator-metrics.csv").string(), fronts, indicators);
+        writeCoverage((out / "binary-coverage-metrics.csv").string(), fronts, coverage);
+
+        std::cout << "Arquivos: " << fronts.size()
+                  << ", fronte de referência: " << reference_front.size() / ResultFront::NUM_OBJECTIVES
+                  << " soluções\n\n";
+        std::cout << std::left << std::setw(20) << "Algoritmo" << std::right
+                  << std::setw(12) << "Soluções" << std::setw(14) << "HV norm."
+                  << std::setw(18) << "HV" << std::setw(10) << "HV/ref" << "\n";
+        for (size_t f = 0; f < fronts.size(); ++f) {
+            std::cout << std::left << std::setw(20) << fronts[f].algorithm << std::right
+                      << std::setw(12) << fronts[f].solutions
+                      << std::fixed << std::setprecision(6) << std::setw(14) << volumes[f].normalized
+                      << std::setprecision(2) << std::setw(18) << volumes[f].raw
+                      << std::setprecision(4) << std::setw(10) << volumes[f].ratio << "\n";
+        }
+
+        std::cout << "\n" << std::left << std::setw(20) << "Algoritmo" << std::right
+                  << std::setw(12) << "GD" << std::setw(12) << "IGD" << std::setw(12) << "IGD+"
+                  << std::setw(12) << "Eps+" << std::setw(12) << "Spread" << "\n";
+        for (size_t f = 0; f < fronts.size(); ++f) {
+            std::cout << std::left << std::setw(20) << fronts[f].algorithm << std::right << std::setprecision(6)
+                      << std::setw(12) << indicators[f].gd << std::setw(12) << indicators[f].igd
+                      << std::setw(12) << indicators[f].igd_plus << std::setw(12) << indicators[f].epsilon_additive
+                      << std::setw(12) << indicators[f].spread << "\n";
+        }
+
+        // C(A, B): row A, column B
+        if (fronts.size() > 1) {
+            std::cout << "\nCobertura C(A, B) (linha A, coluna B)\n" << std::setw(20) << "";
+            for (const auto& front : fronts) std::cout << ' ' << std::setw(19) << front.algorithm;
+            std::cout << "\n";
+            for (size_t a = 0; a < fronts.size(); ++a) {
+                std::cout << std::left << std::setw(20) << fronts[a].algorithm << std::right;
+                for (size_t b = 0; b < fronts.size(); ++b) {
+                    if (a == b) {
+                        std::cout << std::setw(20) << "-";
+                    } else {
+                        std::cout << std::setprecision(4) << std::setw(20) << coverage[a * fronts.size() + b];
+                    }
+                }
+                std::cout << "\n";
+            }
+        }
+
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "\nMétricas exportadas para: " << (out / "metrics.csv").string()
+                  << ", " << (out / "indicator-metrics.csv").string() << " e " << (out / "binary-coverage-metrics.csv").string()
+                  << " (" << std::setprecision(3) << elapsed << " s)\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -4,17 +4,42 @@
 
 #include "nsga2-base.hpp"
 #include "utils.hpp"
+#include "hypervolume.hpp"
+#include "telemetry.hpp"
 #include <algorithm>
 #include <numeric>
 #include <iostream>
-#include <fstream>
 #include <cmath>
-#include <filesystem>
 #include <unordered_set>
-#include <iomanip>  // For std::setprecision
+#include <cstring>
+#include <sstream>
 
 namespace tourist {
 
+namespace {
+
+// Merges the sorted ids of a previous front against the sorted members of the
+// current one, reporting the ids that left and the members that entered
+template <typename Members, typename OnRemove, typename OnInsert>
+void diffSortedIds(const std::vector<std::uint64_t>& previous, const Members& current,
+                   OnRemove on_remove, OnInsert on_insert) {
+    size_t p = 0;
+    size_t c = 0;
+    while (p < previous.size() || c < current.size()) {
+        if (c == current.size() || (p < previous.size() && previous[p] < current[c].first)) {
+            on_remove(previous[p++]);
+        } else if (p == previous.size() || current[c].first < previous[p]) {
+            on_insert(current[c].first, *current[c].second);
+            ++c;
+        } else {
+            ++p;
+            ++c;
+        }
+    }
+}
+
+} // namespace
+
 // Validate parameters for NSGA-II
 void NSGA2Base::Parameters::validate() const {
     if (population_size == 0) throw std::invalid_argument("Population size must be positive");
@@ -23,16 +48,33 @@ void NSGA2Base::Parameters::validate() const {
         throw std::invalid_argument("Crossover rate must be between 0 and 1");
     if (mutation_rate < 0.0 || mutation_rate > 1.0) 
         throw std::invalid_argument("Mutation rate must be between 0 and 1");
+    if (offspring_per_step == 0 || offspring_per_step > population_size)
+        throw std::invalid_argument("Offspring per step must be between 1 and the population size");
+    if (hv_epsilon < 0.0) throw std::invalid_argument("Hypervolume epsilon cannot be negative");
+    if (time_budget_seconds < 0.0) throw std::invalid_argument("Time budget cannot be negative");
+    if (!checkpoint_file.empty() && checkpoint_interval == 0)
+        throw std::invalid_argument("Checkpoint interval must be positive");
+    if (resume && checkpoint_file.empty())
+        throw std::invalid_argument("Resuming requires a checkpoint file");
+}
+
+const char* NSGA2Base::stopReasonName(StopReason reason) {
+    switch (reason) {
+        case StopReason::MAX_GENERATIONS:       return "max generations";
+        case StopReason::HYPERVOLUME_CONVERGED: return "hypervolume converged";
+        case StopReason::FRONT_UNCHANGED:       return "first front unchanged";
+        case StopReason::TIME_BUDGET:           return "time budget";
+        case StopReason::EVALUATION_BUDGET:     return "evaluation budget";
+    }
+    return "unknown";
 }
 
 // Individual implementation
-NSGA2Base::Individual::Individual(std::vector<int> attraction_indices)
-    : chromosome_(std::move(attraction_indices)) {
+NSGA2Base::Individual::Individual(const Chromosome& chromosome)
+    : chromosome_(chromosome) {
     
     // Initialize transport modes between attractions
-    if (chromosome_.size() > 1) {
-        transport_modes_.resize(chromosome_.size() - 1, utils::TransportMode::CAR);
-    }
+    transport_modes_.fill(utils::TransportMode::CAR);
 }
 
 void NSGA2Base::Individual::evaluate(const NSGA2Base& algorithm) {
@@ -56,12 +98,7 @@ void NSGA2Base::Individual::evaluate(const NSGA2Base& algorithm) {
     
     // Apply penalties for invalid routes or empty routes
     if (!is_valid || num_attractions == 0) {
-        objectives_ = {
-            1000.0,                               // High cost penalty
-            utils::Config::DAILY_TIME_LIMIT,      // Excessive time penalty
-            -1.0,                                 // Few attractions penalty
-            -1.0                                  // Few neighborhoods penalty
-        };
+        objectives_ = PENALTY_OBJECTIVES;
     } else {
         // Check if time exceeds the limit with tolerance
         double time_penalty = 0.0;
@@ -83,6 +120,26 @@ void NSGA2Base::Individual::evaluate(const NSGA2Base& algorithm) {
     }
 }
 
+NSGA2Base::Individual::EvaluationKey NSGA2Base::Individual::evaluationKey() const {
+    EvaluationKey key;
+    key.chromosome = chromosome_;
+    key.modes.fill(utils::TransportMode::CAR);
+    if (chromosome_.size() > 1) {
+        std::copy(transport_modes_.begin(), transport_modes_.begin() + (chromosome_.size() - 1),
+                  key.modes.begin());
+    }
+    return key;
+}
+
+std::uint64_t NSGA2Base::Individual::hashKey(const EvaluationKey& key) {
+    // Fold the modes (one bit per segment) into the sequence hash
+    std::uint64_t mode_bits = 0;
+    for (size_t i = 0; i < key.modes.size(); ++i) {
+        mode_bits |= static_cast<std::uint64_t>(key.modes[i] == utils::TransportMode::WALK) << i;
+    }
+    return mixHash(key.chromosome.hash() ^ (mode_bits * 0x9e3779b97f4a7c15ULL));
+}
+
 bool NSGA2Base::Individual::dominates(const Individual& other) const {
     // According to Deb's paper Section III:
     // A solution i is said to dominate solution j if:
@@ -119,17 +176,14 @@ bool NSGA2Base::Individual::dominates(const Individual& other) const {
 void NSGA2Base::Individual::determineTransportModes(const NSGA2Base& algorithm) {
     if (chromosome_.size() <= 1) return;
     
-    // Initialize transport modes
-    transport_modes_.resize(chromosome_.size() - 1);
-    
     // Determine optimal mode for each segment
     for (size_t i = 0; i < chromosome_.size() - 1; ++i) {
         int from_idx = chromosome_[i];
         int to_idx = chromosome_[i + 1];
         
         // Check for valid indices
-        if (from_idx >= 0 && static_cast<size_t>(from_idx) < algorithm.attractions_.size() &&
-            to_idx >= 0 && static_cast<size_t>(to_idx) < algorithm.attractions_.size()) {
+        if (static_cast<size_t>(from_idx) < algorithm.attractions_.size() &&
+            static_cast<size_t>(to_idx) < algorithm.attractions_.size()) {
             
             try {
                 // Get attraction names
@@ -168,22 +222,17 @@ Route NSGA2Base::Individual::constructRoute(const NSGA2Base& algorithm) const {
     
     try {
         // Add first attraction to the route
-        if (chromosome_[0] >= 0 && 
-            static_cast<size_t>(chromosome_[0]) < algorithm.attractions_.size()) {
+        if (chromosome_[0] < algorithm.attractions_.size()) {
             const auto& first_attr = algorithm.attractions_[chromosome_[0]];
             route.addAttraction(first_attr);
             
             // Add subsequent attractions with transport modes
             for (size_t i = 1; i < chromosome_.size(); ++i) {
-                if (chromosome_[i] >= 0 && 
-                    static_cast<size_t>(chromosome_[i]) < algorithm.attractions_.size()) {
+                if (chromosome_[i] < algorithm.attractions_.size()) {
                     const auto& attr = algorithm.attractions_[chromosome_[i]];
                     
-                    // Use the corresponding transport mode (default to CAR if not available)
-                    utils::TransportMode mode = (i-1 < transport_modes_.size()) ? 
-                                              transport_modes_[i-1] : utils::TransportMode::CAR;
-                    
-                    route.addAttraction(attr, mode);
+                    // Use the corresponding transport mode
+                    route.addAttraction(attr, transport_modes_[i-1]);
                 }
             }
         }
@@ -197,7 +246,8 @@ Route NSGA2Base::Individual::constructRoute(const NSGA2Base& algorithm) const {
 // NSGA2Base implementation
 NSGA2Base::NSGA2Base(const std::vector<Attraction>& attractions, Parameters params)
     : attractions_(attractions)
-    , params_(std::move(params)) {
+    , params_(std::move(params))
+    , fitness_cache_(params_.fitness_cache_size) {
     
     // Validate parameters
     params_.validate();
@@ -207,6 +257,11 @@ NSGA2Base::NSGA2Base(const std::vector<Attraction>& attractions, Parameters para
         throw std::runtime_error("No attractions provided");
     }
     
+    // Attraction indices must fit in the chromosome's gene type
+    if (attractions.size() > Individual::Chromosome::MAX_GENES) {
+        throw std::invalid_argument("Too many attractions for the chromosome representation");
+    }
+    
     // Verify transport matrices are loaded
     if (!utils::TransportMatrices::matrices_loaded) {
         throw std::runtime_error("Transport matrices must be loaded before initializing NSGA-II");
@@ -217,9 +272,11 @@ void NSGA2Base::initializePopulation() {
     population_.clear();
     population_.reserve(params_.population_size);
     
-    // Create a base chromosome with all attraction indices
-    std::vector<int> base_chrom(attractions_.size());
-    std::iota(base_chrom.begin(), base_chrom.end(), 0);  // Fill with 0, 1, 2, ..., n-1
+    using Gene = Individual::Chromosome::Gene;
+    const size_t max_length = std::min(Individual::MAX_ROUTE_LENGTH, attractions_.size());
+    
+    // Buffer for a random permutation of all attraction indices
+    std::array<Gene, Individual::Chromosome::MAX_GENES> perm;
     
     // Create initial population with diverse solutions
     for (size_t i = 0; i < params_.population_size; ++i) {
@@ -227,7 +284,7 @@ void NSGA2Base::initializePopulation() {
         size_t chrom_size;
         if (i < params_.population_size / 3) {
             // First third: full-sized chromosomes
-            chrom_size = std::min(size_t(8), attractions_.size()); // Limit to 8 attractions max
+            chrom_size = max_length; // Limit to MAX_ROUTE_LENGTH attractions
         } else if (i < params_.population_size * 2 / 3) {
             // Middle third: medium-sized chromosomes
             std::uniform_int_distribution<size_t> dist(
@@ -241,19 +298,18 @@ void NSGA2Base::initializePopulation() {
             chrom_size = dist(rng_);
         }
         
-        // Create a copy of the base chromosome
-        auto chrom = base_chrom;
+        // Shuffle all attraction indices to create a random order
+        std::iota(perm.begin(), perm.begin() + attractions_.size(), Gene(0));  // Fill with 0, 1, 2, ..., n-1
+        std::shuffle(perm.begin(), perm.begin() + attractions_.size(), rng_);
         
-        // Shuffle to create a random order
-        std::shuffle(chrom.begin(), chrom.end(), rng_);
-        
-        // Resize to desired length
-        if (chrom_size < chrom.size()) {
-            chrom.resize(chrom_size);
+        // Keep the first chrom_size genes
+        Individual::Chromosome chrom;
+        for (size_t g = 0; g < std::min(chrom_size, max_length); ++g) {
+            chrom.push_back(perm[g]);
         }
         
         // Create and add the individual
-        auto ind = std::make_shared<Individual>(std::move(chrom));
+        auto ind = std::make_shared<Individual>(chrom);
         ind->determineTransportModes(*this);
         population_.push_back(std::move(ind));
     }
@@ -262,9 +318,36 @@ void NSGA2Base::initializePopulation() {
     evaluatePopulation(population_);
 }
 
+// Repeated (chromosome, modes) pairs are answered from the fitness cache
 void NSGA2Base::evaluatePopulation(Population& pop) {
-    for (auto& ind : pop) {
-        ind->evaluate(*this);
+    ScopedPhase phase(profiler(), Phase::EVALUATION);
+    
+    if (!fitness_cache_.enabled()) {
+        for (auto& ind : pop) {
+            ind->evaluate(*this);
+        }
+        run_info_.evaluations += pop.size();
+    } else {
+        for (auto& ind : pop) {
+            const auto key = ind->evaluationKey();
+            const std::uint64_t hash = Individual::hashKey(key);
+            
+            if (const auto* cached = fitness_cache_.find(hash, key)) {
+                ind->objectives_ = *cached;
+                continue;
+            }
+            
+            ind->evaluate(*this);
+            ++run_info_.evaluations;
+            fitness_cache_.insert(hash, key, ind->objectives_);
+        }
+    }
+    
+    if (params_.external_archive) {
+        ScopedPhase archive_phase(profiler(), Phase::ARCHIVE);
+        for (const auto& ind : pop) {
+            archiveInsert(*ind);
+        }
     }
 }
 
@@ -347,61 +430,55 @@ std::vector<NSGA2Base::Front> NSGA2Base::fastNonDominatedSort(const Population&
 }
 
 // Crowding Distance Assignment (Section III-B)
-void NSGA2Base::calculateCrowdingDistances(Front& front) const {
-    size_t n = front.size();
+// Objectives are copied once into columns and ordered by index permutation,
+// so the front itself is never sorted
+void NSGA2Base::calculateCrowdingDistances(Front& front) {
+    const size_t n = front.size();
+    if (n == 0) return;
     
-    // Skip if front is empty or has only one solution
-    if (n <= 1) {
-        if (n == 1) {
-            front[0]->setCrowdingDistance(std::numeric_limits<double>::infinity());
+    ScopedPhase phase(profiler(), Phase::CROWDING);
+    const size_t m = Individual::NUM_OBJECTIVES;
+    double* columns = crowding_.reset(n, m);
+    for (size_t i = 0; i < n; ++i) {
+        const auto& obj = front[i]->objectives_;
+        for (size_t k = 0; k < m; ++k) {
+            columns[k * n + i] = obj[k];
         }
-        return;
     }
     
-    // Initialize distances to zero
-    for (auto& ind : front) {
-        ind->setCrowdingDistance(0.0);
+    const auto& distances = crowding_.compute();
+    for (size_t i = 0; i < n; ++i) {
+        front[i]->crowding_distance_ = distances[i];
     }
-    
-    // Number of objectives
-    size_t m = front[0]->getObjectives().size();
-    
-    // For each objective m (as per III-B)
-    for (size_t obj = 0; obj < m; ++obj) {
-        // Sort the population based on objective m
-        std::sort(front.begin(), front.end(),
-                 [obj](const IndividualPtr& a, const IndividualPtr& b) {
-                     return a->getObjectives()[obj] < b->getObjectives()[obj];
-                 });
-        
-        // Boundary points are assigned an infinite distance
-        front[0]->setCrowdingDistance(std::numeric_limits<double>::infinity());
-        front[n-1]->setCrowdingDistance(std::numeric_limits<double>::infinity());
-        
-        // Calculate range for this objective
-        double obj_min = front[0]->getObjectives()[obj];
-        double obj_max = front[n-1]->getObjectives()[obj];
-        double range = obj_max - obj_min;
-        
-        // Skip if all solutions have the same value for this objective
-        if (std::fabs(range) < 1e-10) continue;
-        
-        // For i = 2 to (l-1) - compute normalized distances
-        for (size_t i = 1; i < n - 1; ++i) {
-            // Add the normalized distance to existing crowding distance
-            double distance = (front[i+1]->getObjectives()[obj] - 
-                             front[i-1]->getObjectives()[obj]) / range;
-            front[i]->setCrowdingDistance(front[i]->getCrowdingDistance() + distance);
-        }
+}
+
+void NSGA2Base::ensureCrowding(size_t level) {
+    if (level < fronts_.size() && !crowding_valid_[level]) {
+        calculateCrowdingDistances(fronts_[level]);
+        crowding_valid_[level] = true;
     }
 }
 
-NSGA2Base::Population NSGA2Base::createOffspring(const Population& parents) {
+NSGA2Base::Population NSGA2Base::createOffspring(const Population& parents, size_t count) {
+    ScopedPhase phase(profiler(), Phase::OFFSPRING);
+    
     Population offspring;
-    offspring.reserve(parents.size());
+    offspring.reserve(count);
+    
+    // Chromosomes already present among the parents and the offspring so far
+    const bool deduplicate = params_.deduplicate_offspring;
+    if (deduplicate) {
+        offspring_seen_.clear();
+        for (const auto& parent : parents) {
+            offspring_seen_.insert(parent->getChromosome().hash(), parent->getChromosome());
+        }
+    }
+    
+    // Give up on uniqueness after this many rejected children (tiny search spaces)
+    size_t rejections_left = MAX_DUPLICATE_REJECTIONS_PER_CHILD * count;
     
     // Create offspring using tournament selection, crossover, and mutation
-    while (offspring.size() < parents.size()) {
+    while (offspring.size() < count) {
         // Select parents using tournament selection
         auto parent1 = tournamentSelection(parents);
         auto parent2 = tournamentSelection(parents);
@@ -422,6 +499,13 @@ NSGA2Base::Population NSGA2Base::createOffspring(const Population& parents) {
             mutate(child);
         }
         
+        // Discard children that duplicate a parent or an earlier child
+        if (deduplicate && rejections_left > 0 &&
+            !offspring_seen_.insert(child->getChromosome().hash(), child->getChromosome())) {
+            --rejections_left;
+            continue;
+        }
+        
         // Add to offspring population
         offspring.push_back(std::move(child));
     }
@@ -452,7 +536,9 @@ NSGA2Base::IndividualPtr NSGA2Base::tournamentSelection(const Population& pop) {
         return ind2;  // ind2 has better (lower) rank
     }
     else {
-        // Same rank, select based on crowding distance (higher is better)
+        // Same rank, select based on crowding distance (higher is better);
+        // distances of a level are only computed once a tournament needs them
+        ensureCrowding(static_cast<size_t>(ind1->getRank()));
         return (ind1->getCrowdingDistance() > ind2->getCrowdingDistance()) ? ind1 : ind2;
     }
 }
@@ -470,13 +556,10 @@ NSGA2Base::IndividualPtr NSGA2Base::crossover(const IndividualPtr& parent1, cons
     
     // Determine child size (between min and max parent sizes, but limit max size)
     size_t min_size = std::min(p1_chrom.size(), p2_chrom.size());
-    size_t max_size = std::min(size_t(8), std::max(p1_chrom.size(), p2_chrom.size()));
+    size_t max_size = std::min(Individual::MAX_ROUTE_LENGTH, std::max(p1_chrom.size(), p2_chrom.size()));
     std::uniform_int_distribution<size_t> size_dist(min_size, max_size);
     size_t child_size = size_dist(rng_);
     
-    // Create a map to track which attractions are already included
-    std::vector<bool> included(attractions_.size(), false);
-    
     // Select crossover points
     std::uniform_int_distribution<size_t> point_dist(0, p1_chrom.size() - 1);
     size_t cx_point1 = point_dist(rng_);
@@ -487,25 +570,22 @@ NSGA2Base::IndividualPtr NSGA2Base::crossover(const IndividualPtr& parent1, cons
         std::swap(cx_point1, cx_point2);
     }
     
-    // Start with an empty child chromosome
-    std::vector<int> child_chrom;
-    child_chrom.reserve(child_size);
+    // Start with an empty child chromosome; its bitmask tracks included attractions
+    Individual::Chromosome child_chrom;
     
     // First, copy the segment from parent1 between crossover points
     for (size_t i = cx_point1; i <= cx_point2 && i < p1_chrom.size(); ++i) {
-        int gene = p1_chrom[i];
-        if (gene >= 0 && static_cast<size_t>(gene) < attractions_.size()) {
+        auto gene = p1_chrom[i];
+        if (gene < attractions_.size()) {
             child_chrom.push_back(gene);
-            included[gene] = true;
         }
     }
     
     // Fill the remaining positions with genes from parent2
     for (size_t i = 0; i < p2_chrom.size() && child_chrom.size() < child_size; ++i) {
-        int gene = p2_chrom[i];
-        if (gene >= 0 && static_cast<size_t>(gene) < attractions_.size() && !included[gene]) {
-            child_chrom.push_back(gene);
-            included[gene] = true;
+        auto gene = p2_chrom[i];
+        if (gene < attractions_.size()) {
+            child_chrom.push_back(gene);  // Ignored if already included
         }
     }
     
@@ -514,32 +594,31 @@ NSGA2Base::IndividualPtr NSGA2Base::crossover(const IndividualPtr& parent1, cons
         // Skip the segment already copied
         if (i >= cx_point1 && i <= cx_point2) continue;
         
-        int gene = p1_chrom[i];
-        if (gene >= 0 && static_cast<size_t>(gene) < attractions_.size() && !included[gene]) {
+        auto gene = p1_chrom[i];
+        if (gene < attractions_.size()) {
             child_chrom.push_back(gene);
-            included[gene] = true;
         }
     }
     
     // If still not enough, try random attractions
     if (child_chrom.size() < child_size && child_chrom.size() < attractions_.size()) {
-        std::vector<int> available;
+        std::array<Individual::Chromosome::Gene, Individual::Chromosome::MAX_GENES> available;
+        size_t num_available = 0;
         for (size_t i = 0; i < attractions_.size(); ++i) {
-            if (!included[i]) {
-                available.push_back(i);
+            if (!child_chrom.contains(i)) {
+                available[num_available++] = static_cast<Individual::Chromosome::Gene>(i);
             }
         }
         
-        std::shuffle(available.begin(), available.end(), rng_);
+        std::shuffle(available.begin(), available.begin() + num_available, rng_);
         
-        for (int gene : available) {
-            if (child_chrom.size() >= child_size) break;
-            child_chrom.push_back(gene);
+        for (size_t i = 0; i < num_available && child_chrom.size() < child_size; ++i) {
+            child_chrom.push_back(available[i]);
         }
     }
     
     // Create the child individual
-    auto child = std::make_shared<Individual>(std::move(child_chrom));
+    auto child = std::make_shared<Individual>(child_chrom);
     
     // Determine optimal transport modes
     child->determineTransportModes(*this);
@@ -549,7 +628,7 @@ NSGA2Base::IndividualPtr NSGA2Base::crossover(const IndividualPtr& parent1, cons
 
 // Mutation operator - we use a problem-specific mutation
 void NSGA2Base::mutate(IndividualPtr individual) {
-    auto& chrom = const_cast<std::vector<int>&>(individual->getChromosome());
+    auto& chrom = individual->chromosome_;
     
     if (chrom.size() < 2) {
         return;  // Need at least 2 genes for mutation
@@ -572,7 +651,7 @@ void NSGA2Base::mutate(IndividualPtr individual) {
             }
             
             // Swap genes
-            std::swap(chrom[pos1], chrom[pos2]);
+            chrom.swap(pos1, pos2);
             break;
         }
         
@@ -585,11 +664,8 @@ void NSGA2Base::mutate(IndividualPtr individual) {
             // Skip if positions are the same
             if (from_pos == to_pos) break;
             
-            // Store the gene to move
-            int gene = chrom[from_pos];
-            
-            // Remove from original position
-            chrom.erase(chrom.begin() + from_pos);
+            // Remove the gene from its original position
+            auto gene = chrom.erase(from_pos);
             
             // Adjust to_pos if needed
             if (to_pos > from_pos) {
@@ -597,7 +673,7 @@ void NSGA2Base::mutate(IndividualPtr individual) {
             }
             
             // Insert at new position
-            chrom.insert(chrom.begin() + to_pos, gene);
+            chrom.insert(to_pos, gene);
             break;
         }
         
@@ -605,35 +681,28 @@ void NSGA2Base::mutate(IndividualPtr individual) {
             // Add/Remove Mutation: Add or remove an attraction
             std::uniform_real_distribution<> prob_dist(0.0, 1.0);
             
-            if (chrom.size() < std::min(size_t(8), attractions_.size()) && prob_dist(rng_) < 0.5) {
+            if (chrom.size() < std::min(Individual::MAX_ROUTE_LENGTH, attractions_.size()) && prob_dist(rng_) < 0.5) {
                 // Add a new attraction
                 
                 // Find attractions not already in the chromosome
-                std::vector<int> available;
-                std::vector<bool> used(attractions_.size(), false);
-                
-                for (int gene : chrom) {
-                    if (gene >= 0 && static_cast<size_t>(gene) < attractions_.size()) {
-                        used[gene] = true;
-                    }
-                }
-                
+                std::array<Individual::Chromosome::Gene, Individual::Chromosome::MAX_GENES> available;
+                size_t num_available = 0;
                 for (size_t i = 0; i < attractions_.size(); ++i) {
-                    if (!used[i]) {
-                        available.push_back(i);
+                    if (!chrom.contains(i)) {
+                        available[num_available++] = static_cast<Individual::Chromosome::Gene>(i);
                     }
                 }
                 
                 // Add a random available attraction
-                if (!available.empty()) {
-                    std::uniform_int_distribution<size_t> idx_dist(0, available.size() - 1);
-                    int new_gene = available[idx_dist(rng_)];
+                if (num_available > 0) {
+                    std::uniform_int_distribution<size_t> idx_dist(0, num_available - 1);
+                    auto new_gene = available[idx_dist(rng_)];
                     
                     // Insert at a random position
                     std::uniform_int_distribution<size_t> pos_dist(0, chrom.size());
                     size_t pos = pos_dist(rng_);
                     
-                    chrom.insert(chrom.begin() + pos, new_gene);
+                    chrom.insert(pos, new_gene);
                 }
             } 
             else if (chrom.size() > 1) {
@@ -641,7 +710,7 @@ void NSGA2Base::mutate(IndividualPtr individual) {
                 std::uniform_int_distribution<size_t> pos_dist(0, chrom.size() - 1);
                 size_t pos = pos_dist(rng_);
                 
-                chrom.erase(chrom.begin() + pos);
+                chrom.erase(pos);
             }
             break;
         }
@@ -651,8 +720,181 @@ void NSGA2Base::mutate(IndividualPtr individual) {
     individual->determineTransportModes(*this);
 }
 
+// Steady-state generation: population_size evaluations spread over small steps.
+// Each step inserts offspring_per_step children into the maintained fronts and then
+// drops the same number of individuals from the last front, so only the levels an
+// insertion actually touches are updated instead of re-sorting the population.
+void NSGA2Base::steadyStateGeneration() {
+    const size_t step = params_.offspring_per_step;
+    
+    for (size_t produced = 0; produced < params_.population_size; produced += step) {
+        Population offspring = createOffspring(population_, step);
+        {
+            ScopedPhase phase(profiler(), Phase::SORTING);
+            for (const auto& child : offspring) {
+                insertIntoFronts(child);
+                population_.push_back(child);
+            }
+        }
+        
+        ScopedPhase phase(profiler(), Phase::SELECTION);
+        for (size_t k = 0; k < offspring.size(); ++k) {
+            removeWorstFromFronts();
+        }
+    }
+}
+
+// ENLU insertion: place the individual in the first level where no member dominates it;
+// members it dominates are pushed down one level, cascading through later levels
+// Levels whose membership changes have their crowding distances invalidated
+void NSGA2Base::insertIntoFronts(const IndividualPtr& ind) {
+    size_t level = 0;
+    while (level < fronts_.size() &&
+           std::any_of(fronts_[level].begin(), fronts_[level].end(),
+                       [&ind](const IndividualPtr& member) { return member->dominates(*ind); })) {
+        ++level;
+    }
+    
+    Front moving{ind};
+    while (!moving.empty()) {
+        // Past the last level: the moving set forms a new last front
+        if (level == fronts_.size()) {
+            for (auto& m : moving) m->setRank(static_cast<int>(level));
+            fronts_.push_back(std::move(moving));
+            crowding_valid_.push_back(false);
+            break;
+        }
+        
+        Front& front = fronts_[level];
+        auto demoted_begin = std::partition(front.begin(), front.end(),
+            [&moving](const IndividualPtr& member) {
+                return std::none_of(moving.begin(), moving.end(),
+                                    [&member](const IndividualPtr& m) { return m->dominates(*member); });
+            });
+        
+        // Every member is dominated: the whole level and all below it shift down by one
+        if (demoted_begin == front.begin()) {
+            for (auto& m : moving) m->setRank(static_cast<int>(level));
+            fronts_.insert(fronts_.begin() + level, std::move(moving));
+            crowding_valid_.insert(crowding_valid_.begin() + level, false);
+            for (size_t l = level + 1; l < fronts_.size(); ++l) {
+                for (auto& m : fronts_[l]) m->setRank(static_cast<int>(l));
+            }
+            break;
+        }
+        
+        Front demoted(demoted_begin, front.end());
+        front.erase(demoted_begin, front.end());
+        for (auto& m : moving) {
+            m->setRank(static_cast<int>(level));
+            front.push_back(m);
+        }
+        crowding_valid_[level] = false;
+        
+        moving = std::move(demoted);
+        ++level;
+    }
+}
+
+// Deleting from the last level never changes the rank of any other individual
+void NSGA2Base::removeWorstFromFronts() {
+    if (fronts_.empty()) return;
+    
+    Front& last = fronts_.back();
+    IndividualPtr removed;
+    if (params_.survival == Parameters::Survival::HYPERVOLUME) {
+        removed = truncateByHypervolume(last, last.size() - 1).front();
+    } else {
+        ensureCrowding(fronts_.size() - 1);
+        auto worst = std::min_element(last.begin(), last.end(),
+            [](const IndividualPtr& a, const IndividualPtr& b) {
+                return a->getCrowdingDistance() < b->getCrowdingDistance();
+            });
+        removed = *worst;
+        last.erase(worst);
+    }
+    
+    if (last.empty()) {
+        fronts_.pop_back();
+        crowding_valid_.pop_back();
+    } else {
+        crowding_valid_.back() = false;
+    }
+    
+    auto it = std::find(population_.begin(), population_.end(), removed);
+    if (it != population_.end()) {
+        *it = std::move(population_.back());
+        population_.pop_back();
+    }
+}
+
+// SMS-EMOA survival (Beume et al., 2007): members leave one at a time, always the
+// one with the smallest exclusive hypervolume contribution, measured against the
+// front's worst value plus one in every objective. Removing a member only adds to
+// the contributions of members that shared volume with it alone, so only those
+// are measured again.
+NSGA2Base::Front NSGA2Base::truncateByHypervolume(Front& front, size_t keep) const {
+    Front removed;
+    if (front.size() <= keep) return removed;
+    
+    constexpr size_t m = Individual::NUM_OBJECTIVES;
+    std::vector<double> values(front.size() * m);
+    std::vector<double> reference(m, std::numeric_limits<double>::lowest());
+    for (size_t j = 0; j < front.size(); ++j) {
+        const auto& objectives = front[j]->getObjectives();
+        for (size_t i = 0; i < m; ++i) {
+            values[j * m + i] = objectives[i];
+            reference[i] = std::max(reference[i], objectives[i]);
+        }
+    }
+    for (double& value : reference) value += 1.0;
+    
+    std::vector<double> contributions(front.size());
+    utils::HypervolumeCalculator::contributions(values.data(), front.size(), m, reference.data(),
+                                                contributions.data(), 0);
+    
+    std::vector<double> others;
+    while (front.size() > keep) {
+        const size_t worst = std::min_element(contributions.begin(), contributions.end()) - contributions.begin();
+        Individual::Objectives gone;
+        std::copy_n(&values[worst * m], m, gone.begin());
+        removed.push_back(front[worst]);
+        
+        const size_t last = front.size() - 1;
+        front[worst] = std::move(front[last]);
+        front.pop_back();
+        std::copy_n(&values[last * m], m, &values[worst * m]);
+        values.resize(last * m);
+        contributions[worst] = contributions[last];
+        contributions.pop_back();
+        
+        const size_t n = front.size();
+        for (size_t q = 0; q < n; ++q) {
+            // The volume q shared only with the removed member lies beyond their
+            // join; if another member covers the join, q gained nothing
+            double join[m];
+            for (size_t i = 0; i < m; ++i) join[i] = std::max(gone[i], values[q * m + i]);
+            bool covered = false;
+            for (size_t r = 0; r < n && !covered; ++r) {
+                if (r == q) continue;
+                covered = true;
+                for (size_t i = 0; i < m && covered; ++i) covered = values[r * m + i] <= join[i];
+            }
+            if (covered) continue;
+            
+            others.assign(values.begin(), values.begin() + q * m);
+            others.insert(others.end(), values.begin() + (q + 1) * m, values.end());
+            contributions[q] = utils::HypervolumeCalculator::contribution(&values[q * m], others.data(), n - 1, m,
+                                                                          reference.data(), 0);
+        }
+    }
+    return removed;
+}
+
 // "The overall algorithm" (Section III-C)
 NSGA2Base::Population NSGA2Base::selectNextGeneration(const Population& parents, const Population& offspring) {
+    ScopedPhase phase(profiler(), Phase::SELECTION);
+    
     // Rt = Pt ∪ Qt (combine parent and offspring populations)
     Population combined;
     combined.reserve(parents.size() + offspring.size());
@@ -660,146 +902,273 @@ NSGA2Base::Population NSGA2Base::selectNextGeneration(const Population& parents,
     combined.insert(combined.end(), offspring.begin(), offspring.end());
     
     // F = fast-non-dominated-sort(Rt)
-    auto fronts = fastNonDominatedSort(combined);
+    std::vector<Front> fronts;
+    {
+        ScopedPhase sort_phase(profiler(), Phase::SORTING);
+        fronts = fastNonDominatedSort(combined);
+    }
     
     // Pt+1 = ∅ and i = 1
     Population next_gen;
     next_gen.reserve(params_.population_size);
     
     // Until |Pt+1| + |Fi| ≤ N (where N is population size)
+    // Crowding distances of fully accepted fronts are deferred until a tournament needs them
     size_t i = 0;
     while (i < fronts.size() && next_gen.size() + fronts[i].size() <= params_.population_size) {
-        // Calculate crowding distance in Fi
-        calculateCrowdingDistances(fronts[i]);
-        
         // Pt+1 = Pt+1 ∪ Fi
         next_gen.insert(next_gen.end(), fronts[i].begin(), fronts[i].end());
         
         // i = i + 1
         i++;
     }
+    crowding_valid_.assign(i, false);
     
     // If we need more solutions to fill the population
     if (next_gen.size() < params_.population_size && i < fronts.size()) {
-        // Calculate crowding distance in Fi
-        calculateCrowdingDistances(fronts[i]);
-        
-        // Sort Fi by crowded comparison operator
-        std::sort(fronts[i].begin(), fronts[i].end(), 
-                 [](const IndividualPtr& a, const IndividualPtr& b) {
-                     // Higher crowding distance is better for same rank
-                     return a->getCrowdingDistance() > b->getCrowdingDistance();
-                 });
+        size_t remaining = std::min(params_.population_size - next_gen.size(), fronts[i].size());
+        
+        if (params_.survival == Parameters::Survival::HYPERVOLUME) {
+            // Drop the least contributors of Fi; distances are computed when needed
+            truncateByHypervolume(fronts[i], remaining);
+            crowding_valid_.push_back(false);
+        } else {
+            // Calculate crowding distance in Fi (the only front that is truncated)
+            calculateCrowdingDistances(fronts[i]);
+            
+            // Move the most widely spread solutions of Fi to the front (crowded comparison)
+            std::nth_element(fronts[i].begin(), fronts[i].begin() + (remaining - 1), fronts[i].end(),
+                     [](const IndividualPtr& a, const IndividualPtr& b) {
+                         // Higher crowding distance is better for same rank
+                         return a->getCrowdingDistance() > b->getCrowdingDistance();
+                     });
+            fronts[i].resize(remaining);
+            
+            // Distances of the kept part come from the full front, as in the paper
+            crowding_valid_.push_back(true);
+        }
         
         // Add solutions from Fi to Pt+1 until |Pt+1| = N
-        size_t remaining = params_.population_size - next_gen.size();
-        next_gen.insert(next_gen.end(), fronts[i].begin(), 
-                      fronts[i].begin() + std::min(remaining, fronts[i].size()));
+        next_gen.insert(next_gen.end(), fronts[i].begin(), fronts[i].end());
+        i++;
     }
     
+    // The accepted fronts are the non-domination levels of Pt+1
+    fronts.resize(i);
+    fronts_ = std::move(fronts);
+    
     return next_gen;
 }
 
 std::vector<Solution> NSGA2Base::run() {
-    // Create file for tracking generations data
-    std::filesystem::path results_dir = "../results";
-    std::ofstream generations_file((results_dir / "nsga2-geracoes.csv").string(), std::ios::out);
-    if (generations_file.is_open()) {
-        generations_file << "Generation;Front size;Best Cost;Best Time;Max Attractions" << std::endl;
+    const auto run_start = std::chrono::steady_clock::now();
+    
+    // Start each run with an empty cache and fresh stopping state
+    fitness_cache_.clear();
+    run_info_ = RunInfo();
+    profile_.clear();
+    if (params_.profile_phases && params_.perf_counters && !profile_.countersEnabled()) {
+        profile_.enableCounters();
+    }
+    hv_history_.clear();
+    front_signature_.clear();
+    unchanged_generations_ = 0;
+    archive_.clear();
+    streamed_ids_.clear();
+    hv_tracker_.clear();
+    tracked_ids_.clear();
+    stream_generation_ = 0;
+    
+    // Archive changes are streamed as they happen, starting with the initial population
+    std::unique_ptr<ArchiveStream> archive_stream;
+    if (!params_.archive_stream_file.empty()) {
+        std::vector<std::string> names;
+        names.reserve(attractions_.size());
+        for (const auto& attraction : attractions_) names.push_back(attraction.getName());
+        
+        archive_stream = std::make_unique<ArchiveStream>(params_.archive_stream_file, std::move(names),
+                                                         params_.archive_stream_flush);
     }
+    archive_stream_ = archive_stream.get();
     
-    // Initialize population
-    initializePopulation();
+    // Initialize population, or continue a checkpointed run (the archive is rebuilt from its
+    // saved entries). A resumed run appends to the stream and telemetry of the interrupted one.
+    bool resumed = false;
+    {
+        ScopedPhase phase(profiler(), Phase::INITIALIZATION);
+        std::vector<Individual> archived;
+        resumed = params_.resume && restoreCheckpoint(archived);
+        if (archive_stream) {
+            if (resumed) {
+                archive_stream->resume(run_info_.generations);
+            } else {
+                archive_stream->open();
+            }
+        }
+        if (resumed) {
+            stream_generation_ = run_info_.generations;
+            if (params_.external_archive) {
+                ScopedPhase archive_phase(profiler(), Phase::ARCHIVE);
+                for (const auto& ind : archived) archiveInsert(ind);
+                for (const auto& ind : population_) archiveInsert(*ind);
+            }
+        } else {
+            initializePopulation();
+        }
+    }
+    const size_t first_generation = run_info_.generations;
+    
+    // Build the initial levels; afterwards they come out of selection (or ENLU updates)
+    {
+        ScopedPhase phase(profiler(), Phase::SORTING);
+        fronts_ = fastNonDominatedSort(population_);
+        crowding_valid_.assign(fronts_.size(), false);
+    }
+    if (hypervolumeTracked()) {
+        ScopedPhase phase(profiler(), Phase::ARCHIVE);
+        trackFrontHypervolume();
+    }
+    if (params_.profile_phases) {
+        profile_.endGeneration();
+    }
+    
+    const bool steady_state = params_.mode == Parameters::Mode::STEADY_STATE;
+    bool stopped_early = false;
+    
+    // Generation records are delivered to the sinks by a background thread
+    const auto sinks = activeSinks();
+    if (telemetryEnabled(TelemetryLevel::SUMMARY)) {
+        for (auto& sink : sinks) sink->onRunStart(resumed);
+    }
+    std::unique_ptr<TelemetryWriter> telemetry;
+    if (telemetryEnabled(TelemetryLevel::GENERATION) && !sinks.empty()) {
+        telemetry = std::make_unique<TelemetryWriter>(sinks);
+    }
+    
+    // Snapshots are copied here and written to disk by a background thread
+    std::unique_ptr<CheckpointWriter> checkpoints;
+    if (!params_.checkpoint_file.empty()) {
+        checkpoints = std::make_unique<CheckpointWriter>(params_.checkpoint_file);
+    }
+    
+    if (archive_stream && !params_.external_archive) {
+        streamFrontChanges(*archive_stream);
+    }
     
     // Main NSGA-II loop - evolve for max_generations
-    for (size_t gen = 0; gen < params_.max_generations; ++gen) {
-        // Create offspring through selection, crossover, and mutation
-        Population offspring = createOffspring(population_);
+    for (size_t gen = first_generation; gen < params_.max_generations; ++gen) {
+        stream_generation_ = gen + 1;
+        
+        if (steady_state) {
+            steadyStateGeneration();
+        } else {
+            // Create offspring through selection, crossover, and mutation
+            Population offspring = createOffspring(population_, population_.size());
+            
+            // Select next generation from combined parent and offspring populations
+            population_ = selectNextGeneration(population_, offspring);
+        }
         
-        // Select next generation from combined parent and offspring populations
-        population_ = selectNextGeneration(population_, offspring);
+        run_info_.generations = gen + 1;
         
-        // Calculate non-dominated fronts for the new population
-        auto fronts = fastNonDominatedSort(population_);
+        if (hypervolumeTracked()) {
+            ScopedPhase phase(profiler(), Phase::ARCHIVE);
+            trackFrontHypervolume();
+        }
         
-        // Log progress
-        logProgress(gen, fronts);
+        bool stop;
+        {
+            ScopedPhase phase(profiler(), Phase::STOPPING);
+            stop = shouldStop(run_start);
+        }
         
-        // Record generation data for first front
-        if (generations_file.is_open() && !fronts.empty() && !fronts[0].empty()) {
-            // Find best values for each objective in the first front
-            double best_cost = std::numeric_limits<double>::max();
-            double best_time = std::numeric_limits<double>::max();
-            double max_attractions = 0;
+        {
+            ScopedPhase phase(profiler(), Phase::LOGGING);
             
-            // Flag to track if we found valid solutions
-            bool found_valid = false;
+            // Log progress of the first front
+            if constexpr (telemetryCompiled(TelemetryLevel::GENERATION)) {
+                if (telemetry && !fronts_.empty()) {
+                    telemetry->publish(summarizeGeneration(gen, fronts_[0]));
+                }
+            }
             
-            for (const auto& ind : fronts[0]) {
-                const auto& obj = ind->getObjectives();
-                Route test_route = ind->constructRoute(*this);
-                
-                // Check if values are valid (not penalty values) and route is valid
-                if (obj[0] < 999.0 && obj[1] < utils::Config::DAILY_TIME_LIMIT && 
-                    test_route.isValid() && !test_route.getAttractions().empty()) {
-                    found_valid = true;
-                    best_cost = std::min(best_cost, obj[0]);
-                    best_time = std::min(best_time, obj[1]);
-                    max_attractions = std::max(max_attractions, -obj[2]); // Negate to get actual number
+            if (archive_stream) {
+                if (params_.external_archive) {
+                    archive_stream->endGeneration();
+                } else {
+                    streamFrontChanges(*archive_stream);
                 }
             }
             
-            // Only write if we found at least one valid solution
-            if (found_valid) {
-                generations_file << gen << ";" 
-                                << fronts[0].size() << ";" 
-                                << best_cost << ";" 
-                                << best_time << ";"
-                                << max_attractions << std::endl;
+            // The last generation is always saved so the run can be extended later
+            if (checkpoints && (stop || run_info_.generations == params_.max_generations ||
+                                run_info_.generations % params_.checkpoint_interval == 0)) {
+                checkpoints->submit(makeCheckpoint());
             }
         }
+        
+        if (params_.profile_phases) {
+            profile_.endGeneration();
+        }
+        
+        if (stop) {
+            stopped_early = true;
+            break;
+        }
+    }
+    
+    run_info_.elapsed_seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - run_start).count();
+    
+    if (telemetry) {
+        telemetry->close();
+    }
+    if (checkpoints) {
+        checkpoints->close();
+    }
+    if (archive_stream) {
+        archive_stream->close(run_info_.generations);
+    }
+    archive_stream_ = nullptr;
+    run_info_.archive_size = archive_.size();
+    if (telemetryEnabled(TelemetryLevel::SUMMARY)) {
+        RunSummary summary;
+        summary.generations = static_cast<std::uint32_t>(run_info_.generations);
+        summary.evaluations = run_info_.evaluations;
+        summary.elapsed_seconds = run_info_.elapsed_seconds;
+        summary.stop_reason = stopReasonName(run_info_.stop_reason);
+        summary.stopped_early = stopped_early;
+        for (auto& sink : sinks) sink->onRunEnd(summary);
+    }
+    
+    // Result: the external archive, or the first front of the final population
+    std::vector<const Individual*> result;
+    if (params_.external_archive) {
+        result.reserve(archive_.size());
+        archive_.forEach([&result](const auto& entry) { result.push_back(&entry.payload); });
+    } else if (!fronts_.empty()) {
+        result.reserve(fronts_[0].size());
+        for (const auto& ind : fronts_[0]) result.push_back(ind.get());
     }
     
-    // Find non-dominated solutions in final population
-    auto final_fronts = fastNonDominatedSort(population_);
+    // Convert individuals to Solution objects
     std::vector<Solution> solutions;
+    solutions.reserve(result.size());
     
-    // Convert individuals in the first front to Solution objects
-    if (!final_fronts.empty()) {
-        solutions.reserve(final_fronts[0].size());
+    // Deduplicate routes by chromosome hash; a route and its reverse count as one
+    ChromosomeSet<Individual::Chromosome> seen;
+    
+    for (const Individual* ind : result) {
+        // Only add valid routes with at least one attraction
+        if (!ind->isFeasible()) continue;
         
-        // First, deduplicate similar solutions
-        std::unordered_set<std::string> solution_hashes;
+        const auto& chrom = ind->getChromosome();
+        const auto hashes = chrom.hashes();
         
-        for (const auto& ind : final_fronts[0]) {
-            Route route = ind->constructRoute(*this);
-            
-            // Only add valid routes with at least one attraction
-            if (!route.getAttractions().empty() && route.isValid()) {
-                // Create a hash based on the sequence of attractions
-                std::string hash;
-                std::string reverse_hash;
-                
-                const auto& attractions = route.getAttractions();
-                
-                // Forward hash
-                for (const auto* attr : attractions) {
-                    hash += attr->getName() + "|";
-                }
-                
-                // Reverse hash (to detect inverted routes)
-                for (auto it = attractions.rbegin(); it != attractions.rend(); ++it) {
-                    reverse_hash += (*it)->getName() + "|";
-                }
-                
-                // Only add if neither this solution nor its reverse already exists
-                if (solution_hashes.find(hash) == solution_hashes.end() && 
-                    solution_hashes.find(reverse_hash) == solution_hashes.end()) {
-                    solutions.push_back(Solution(route));
-                    solution_hashes.insert(hash);
-                    solution_hashes.insert(reverse_hash); // Also prevent reverse from being added later
-                }
-            }
+        // Inserting the reverse as well prevents it from being added later
+        if (seen.insert(hashes.first, chrom)) {
+            seen.insert(hashes.second, chrom.reversed());
+            solutions.push_back(Solution(ind->constructRoute(*this)));
         }
     }
     
@@ -825,65 +1194,303 @@ std::vector<Solution> NSGA2Base::run() {
                  });
     }
     
-    if (generations_file.is_open()) {
-        generations_file.close();
+    return solutions;
+}
+
+void NSGA2Base::addTelemetrySink(std::shared_ptr<TelemetrySink> sink) {
+    if (sink) {
+        sinks_.push_back(std::move(sink));
     }
+}
+
+// Feasible individuals enter the ND-tree archive unless an archived route weakly
+// dominates them; archived routes they dominate are removed. Both kinds of change
+// are reported to the archive stream, if one is open.
+void NSGA2Base::archiveInsert(const Individual& ind) {
+    if (!ind.isFeasible()) return;
     
-    return solutions;
+    const bool inserted = archive_.insert(ind.objectives_, ind, [this](const auto& entry) {
+        if (archive_stream_) {
+            archive_stream_->remove(stream_generation_, Individual::hashKey(entry.payload.evaluationKey()));
+        }
+    });
+    
+    if (inserted && archive_stream_) {
+        archive_stream_->insert(stream_generation_, makeArchiveEntry(ind, Individual::hashKey(ind.evaluationKey())));
+    }
 }
 
-void NSGA2Base::logProgress(size_t generation, const std::vector<Front>& fronts) const {
-    if (!fronts.empty()) {
-        std::cout << "Generation " << generation 
-                << ": Front size = " << fronts[0].size();
-        
-        // Find best solution values
-        if (!fronts[0].empty()) {
-            double best_cost = std::numeric_limits<double>::max();
-            double best_time = std::numeric_limits<double>::max();
-            double max_attractions = 0;
-            double max_neighborhoods = 0;  // Add this variable
-            bool found_valid = false;
-            
-            for (const auto& ind : fronts[0]) {
-                // Calculate REAL values by constructing the route
-                Route test_route = ind->constructRoute(*this);
-                
-                if (test_route.isValid() && !test_route.getAttractions().empty()) {
-                    found_valid = true;
-                    
-                    // Count unique neighborhoods
-                    std::unordered_set<std::string> neighborhoods;
-                    for (const auto* attraction : test_route.getAttractions()) {
-                        neighborhoods.insert(attraction->getNeighborhood());
-                    }
-                    int actual_neighborhoods = neighborhoods.size();
-                    
-                    // Use actual route values, not objective values
-                    double actual_cost = test_route.getTotalCost();
-                    double actual_time = test_route.getTotalTime();
-                    int actual_attractions = test_route.getNumAttractions();
-                    
-                    best_cost = std::min(best_cost, actual_cost);
-                    best_time = std::min(best_time, actual_time);
-                    max_attractions = std::max(max_attractions, static_cast<double>(actual_attractions));
-                    max_neighborhoods = std::max(max_neighborhoods, static_cast<double>(actual_neighborhoods));  // Track max neighborhoods
-                }
+ArchiveEntry NSGA2Base::makeArchiveEntry(const Individual& ind, std::uint64_t id) const {
+    const auto& obj = ind.getObjectives();
+    const auto& chrom = ind.getChromosome();
+    
+    ArchiveEntry entry;
+    entry.id = id;
+    entry.cost = obj[0];
+    entry.time = obj[1];
+    entry.attractions = static_cast<std::uint32_t>(-obj[2]);
+    entry.neighborhoods = static_cast<std::uint32_t>(-obj[3]);
+    entry.sequence = chrom.toVector();
+    if (chrom.size() > 1) {
+        entry.modes.assign(ind.getTransportModes().begin(),
+                           ind.getTransportModes().begin() + (chrom.size() - 1));
+    }
+    return entry;
+}
+
+// Feasible first-front members are identified by their evaluation key hash; the
+// current ids are merged against the previously streamed ones in sorted order
+std::vector<std::pair<std::uint64_t, const NSGA2Base::Individual*>> NSGA2Base::firstFrontMembers() const {
+    std::vector<std::pair<std::uint64_t, const Individual*>> members;
+    if (!fronts_.empty()) {
+        members.reserve(fronts_[0].size());
+        for (const auto& ind : fronts_[0]) {
+            if (ind->isFeasible()) {
+                members.emplace_back(Individual::hashKey(ind->evaluationKey()), ind.get());
             }
-            
-            // Only display valid solutions
-            if (found_valid) {
-                std::cout << ", Best solution: [Cost=" << std::fixed << std::setprecision(2) << best_cost 
-                        << ", Time=" << std::fixed << std::setprecision(1) << best_time 
-                        << ", Attractions=" << static_cast<int>(max_attractions)
-                        << ", Neighborhoods=" << static_cast<int>(max_neighborhoods) << "]";  // Add neighborhood info
-            } else {
-                std::cout << ", No valid solutions yet";
+        }
+    }
+    std::sort(members.begin(), members.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    members.erase(std::unique(members.begin(), members.end(),
+                              [](const auto& a, const auto& b) { return a.first == b.first; }),
+                  members.end());
+    return members;
+}
+
+void NSGA2Base::streamFrontChanges(ArchiveStream& stream) {
+    const auto current = firstFrontMembers();
+    const size_t generation = run_info_.generations;
+    diffSortedIds(streamed_ids_, current,
+                  [&](std::uint64_t id) { stream.remove(generation, id); },
+                  [&](std::uint64_t id, const Individual& ind) { stream.insert(generation, makeArchiveEntry(ind, id)); });
+    stream.endGeneration();
+    
+    streamed_ids_.clear();
+    for (const auto& item : current) streamed_ids_.push_back(item.first);
+}
+
+bool NSGA2Base::hypervolumeTracked() const {
+    return params_.track_hypervolume || (params_.hv_window > 0 && params_.hv_epsilon > 0.0);
+}
+
+// Members that left the first front take their exclusive volume with them and
+// new members add theirs, so an update costs the changed members only. The
+// rounding of these updates adds up, so the volume is periodically recomputed.
+void NSGA2Base::trackFrontHypervolume() {
+    const auto current = firstFrontMembers();
+    diffSortedIds(tracked_ids_, current,
+                  [&](std::uint64_t id) { hv_tracker_.remove(id); },
+                  [&](std::uint64_t id, const Individual& ind) { hv_tracker_.insert(id, ind.getObjectives().data()); });
+    if (run_info_.generations % HV_REFRESH_INTERVAL == 0) {
+        hv_tracker_.refresh();
+    }
+    
+    tracked_ids_.clear();
+    for (const auto& item : current) tracked_ids_.push_back(item.first);
+}
+
+// Reference of the first-front hypervolume, for the objectives as stored (all
+// minimized): the penalty cost, the daily time limit, zero attractions and zero
+// neighborhoods
+std::vector<double> NSGA2Base::hypervolumeReference() {
+    return {
+        Individual::PENALTY_OBJECTIVES[0],
+        static_cast<double>(utils::Config::DAILY_TIME_LIMIT),
+        0.0,
+        0.0
+    };
+}
+
+// Individuals are trivially copyable, so each one is stored as its raw bytes
+CheckpointData NSGA2Base::makeCheckpoint() const {
+    CheckpointData data;
+    data.record_size = sizeof(Individual);
+    data.parameter_hash = checkpointFingerprint();
+    data.generation = run_info_.generations;
+    data.evaluations = run_info_.evaluations;
+    
+    std::ostringstream rng_state;
+    rng_state << rng_;
+    data.rng_state = rng_state.str();
+    
+    data.records.resize(population_.size() * sizeof(Individual));
+    for (size_t i = 0; i < population_.size(); ++i) {
+        std::memcpy(data.records.data() + i * sizeof(Individual), population_[i].get(), sizeof(Individual));
+    }
+    
+    data.archive.reserve(archive_.size() * sizeof(Individual));
+    archive_.forEach([&data](const auto& entry) {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&entry.payload);
+        data.archive.insert(data.archive.end(), bytes, bytes + sizeof(Individual));
+    });
+    return data;
+}
+
+// Loads population, generation counter, evaluation count and random engine from
+// checkpoint_file, and the external archive entries into archived. Returns false if
+// there is no checkpoint to resume from. The fitness cache and the convergence
+// history are not saved and start empty.
+bool NSGA2Base::restoreCheckpoint(std::vector<Individual>& archived) {
+    CheckpointData data;
+    if (!Checkpoint::read(params_.checkpoint_file, data)) {
+        return false;
+    }
+    
+    if (data.record_size != sizeof(Individual)) {
+        throw std::runtime_error("Checkpoint was written by an incompatible build");
+    }
+    if (data.parameter_hash != checkpointFingerprint() || data.recordCount() != params_.population_size) {
+        throw std::runtime_error("Checkpoint does not match the current parameters and attractions");
+    }
+    
+    std::istringstream rng_state(data.rng_state);
+    rng_state >> rng_;
+    if (!rng_state) {
+        throw std::runtime_error("Invalid random engine state in checkpoint");
+    }
+    
+    population_.clear();
+    population_.reserve(data.recordCount());
+    for (size_t i = 0; i < data.recordCount(); ++i) {
+        auto ind = std::make_shared<Individual>(Individual::Chromosome());
+        std::memcpy(ind.get(), data.records.data() + i * sizeof(Individual), sizeof(Individual));
+        population_.push_back(std::move(ind));
+    }
+    
+    archived.clear();
+    archived.reserve(data.archiveCount());
+    for (size_t i = 0; i < data.archiveCount(); ++i) {
+        archived.emplace_back(Individual::Chromosome());
+        std::memcpy(&archived.back(), data.archive.data() + i * sizeof(Individual), sizeof(Individual));
+    }
+    
+    run_info_.generations = static_cast<size_t>(data.generation);
+    run_info_.evaluations = static_cast<size_t>(data.evaluations);
+    return true;
+}
+
+// Settings a resumed run must share with the checkpointed one. Generation, time and
+// evaluation budgets are left out so that a finished run can be extended.
+std::uint64_t NSGA2Base::checkpointFingerprint() const {
+    std::uint64_t hash = 0;
+    auto combine = [&hash](std::uint64_t value) { hash = mixHash(hash ^ value) + 0x9e3779b97f4a7c15ULL; };
+    auto combineDouble = [&combine](double value) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        combine(bits);
+    };
+    
+    combine(params_.population_size);
+    combineDouble(params_.crossover_rate);
+    combineDouble(params_.mutation_rate);
+    combine(static_cast<std::uint64_t>(params_.mode));
+    combine(params_.offspring_per_step);
+    combine(static_cast<std::uint64_t>(params_.survival));
+    combine(params_.deduplicate_offspring);
+    
+    combine(attractions_.size());
+    for (const auto& attraction : attractions_) {
+        combine(std::hash<std::string>{}(attraction.getName()));
+    }
+    return hash;
+}
+
+// Levels above TOURIST_TELEMETRY_LEVEL are constant false and drop out at compile time
+bool NSGA2Base::telemetryEnabled(TelemetryLevel level) const {
+    return telemetryCompiled(level) &&
+           static_cast<int>(params_.telemetry_level) >= static_cast<int>(level);
+}
+
+std::vector<std::shared_ptr<TelemetrySink>> NSGA2Base::activeSinks() const {
+    if (!sinks_.empty()) {
+        return sinks_;
+    }
+    
+    std::vector<std::shared_ptr<TelemetrySink>> defaults;
+    defaults.push_back(std::make_shared<ConsoleSink>());
+    // The generations CSV only gets rows at GENERATION level; opening it below would truncate it to a header
+    if (!params_.generations_file.empty() && telemetryEnabled(TelemetryLevel::GENERATION)) {
+        defaults.push_back(std::make_shared<CsvSink>(params_.generations_file));
+    }
+    return defaults;
+}
+
+// Evaluates the enabled stopping criteria after a generation and records the reason
+bool NSGA2Base::shouldStop(std::chrono::steady_clock::time_point start) {
+    if (params_.max_evaluations > 0 && run_info_.evaluations >= params_.max_evaluations) {
+        run_info_.stop_reason = StopReason::EVALUATION_BUDGET;
+        return true;
+    }
+    
+    if (params_.time_budget_seconds > 0.0) {
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= params_.time_budget_seconds) {
+            run_info_.stop_reason = StopReason::TIME_BUDGET;
+            return true;
+        }
+    }
+    
+    if (params_.stall_generations > 0) {
+        // Identify the first front by the set of its distinct feasible routes, so
+        // shifting copy counts or penalized members do not reset the count
+        const auto members = firstFrontMembers();
+        std::vector<std::uint64_t> signature;
+        signature.reserve(members.size());
+        for (const auto& item : members) signature.push_back(item.first);
+        
+        unchanged_generations_ = (signature == front_signature_) ? unchanged_generations_ + 1 : 0;
+        front_signature_ = std::move(signature);
+        
+        if (unchanged_generations_ >= params_.stall_generations) {
+            run_info_.stop_reason = StopReason::FRONT_UNCHANGED;
+            return true;
+        }
+    }
+    
+    if (params_.hv_window > 0 && params_.hv_epsilon > 0.0) {
+        // Only the window and the value preceding it are kept
+        hv_history_.push_back(hv_tracker_.volume());
+        if (hv_history_.size() > params_.hv_window + 1) {
+            hv_history_.erase(hv_history_.begin());
+        }
+        
+        // A front without feasible routes has no volume and is not a sign of convergence
+        if (hv_history_.size() > params_.hv_window && hv_history_.front() > 0.0) {
+            double previous = hv_history_.front();
+            double gain = hv_history_.back() - previous;
+            if (gain <= params_.hv_epsilon * previous) {
+                run_info_.stop_reason = StopReason::HYPERVOLUME_CONVERGED;
+                return true;
             }
         }
+    }
+    
+    return false;
+}
+
+// Best objective values among the feasible members of the first front. Objectives
+// of feasible routes are their actual cost, time and counts, so no route is rebuilt.
+GenerationRecord NSGA2Base::summarizeGeneration(size_t generation, const Front& first_front) const {
+    GenerationRecord record;
+    record.generation = static_cast<std::uint32_t>(generation);
+    record.front_size = static_cast<std::uint32_t>(first_front.size());
+    record.best_cost = std::numeric_limits<double>::max();
+    record.best_time = std::numeric_limits<double>::max();
+    record.hypervolume = hypervolumeTracked() ? hv_tracker_.volume() : 0.0;
+    
+    for (const auto& ind : first_front) {
+        if (!ind->isFeasible()) continue;
+        const auto& obj = ind->getObjectives();
         
-        std::cout << std::endl;
+        record.has_feasible = true;
+        record.best_cost = std::min(record.best_cost, obj[0]);
+        record.best_time = std::min(record.best_time, obj[1]);
+        record.max_attractions = std::max(record.max_attractions, static_cast<std::uint32_t>(-obj[2]));
+        record.max_neighborhoods = std::max(record.max_neighborhoods, static_cast<std::uint32_t>(-obj[3]));
     }
+    
+    return record;
 }
 
 // Crowded comparison operator (Section III-B)
@@ -0,0 +1,122 @@
+// File: src/perf-counters.cpp
+
+#include "perf-counters.hpp"
+
+#if TOURIST_ENABLE_PERF_COUNTERS && defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace tourist {
+
+const char* counterName(Counter counter) {
+    switch (counter) {
+        case Counter::CYCLES:        return "cycles";
+        case Counter::INSTRUCTIONS:  return "instructions";
+        case Counter::LLC_MISSES:    return "llc_misses";
+        case Counter::BRANCH_MISSES: return "branch_misses";
+        case Counter::COUNT:         break;
+    }
+    return "unknown";
+}
+
+#if TOURIST_ENABLE_PERF_COUNTERS && defined(__linux__)
+
+namespace {
+
+constexpr std::uint64_t EVENT_CONFIGS[NUM_COUNTERS] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES
+};
+
+int openEvent(std::uint64_t config, int group_fd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = group_fd < 0 ? 1 : 0;   // The leader starts the whole group
+    attr.exclude_kernel = 1;                // Allowed with perf_event_paranoid <= 2
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID |
+                       PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+} // namespace
+
+PerfCounters::PerfCounters() {
+    fds_.fill(-1);
+    
+    // The first counter that opens becomes the group leader
+    for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+        int fd = openEvent(EVENT_CONFIGS[i], group_fd_);
+        if (fd < 0) {
+            if (error_.empty()) error_ = std::string(counterName(static_cast<Counter>(i))) + ": " + std::strerror(errno);
+            continue;
+        }
+        fds_[i] = fd;
+        if (group_fd_ < 0) group_fd_ = fd;
+    }
+    
+    if (group_fd_ < 0) return;
+    ioctl(group_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(group_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounters::~PerfCounters() {
+    for (int fd : fds_) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+bool PerfCounters::read(CounterValues& values) const {
+    values.fill(0);
+    if (group_fd_ < 0) return false;
+    
+    // Layout of a PERF_FORMAT_GROUP read: nr, time_enabled, time_running, {value, id} * nr
+    struct {
+        std::uint64_t nr;
+        std::uint64_t time_enabled;
+        std::uint64_t time_running;
+        struct { std::uint64_t value; std::uint64_t id; } events[NUM_COUNTERS];
+    } data;
+    
+    if (::read(group_fd_, &data, sizeof(data)) <= 0) return false;
+    
+    const double scale = data.time_running > 0 ?
+        static_cast<double>(data.time_enabled) / static_cast<double>(data.time_running) : 1.0;
+    
+    // Events are reported in the order they joined the group, i.e. the order of fds_
+    size_t event = 0;
+    for (size_t i = 0; i < NUM_COUNTERS && event < data.nr; ++i) {
+        if (fds_[i] < 0) continue;
+        values[i] = static_cast<std::uint64_t>(static_cast<double>(data.events[event++].value) * scale);
+    }
+    return true;
+}
+
+#else
+
+PerfCounters::PerfCounters()
+    : error_(PERF_COUNTERS_COMPILED ? "perf_event_open is only available on Linux"
+                                    : "compiled without TOURIST_ENABLE_PERF_COUNTERS") {
+    fds_.fill(-1);
+}
+
+PerfCounters::~PerfCounters() = default;
+
+bool PerfCounters::read(CounterValues& values) const {
+    values.fill(0);
+    return false;
+}
+
+#endif
+
+} // namespace tourist
@@ -0,0 +1,271 @@
+// File: src/phase-profile.cpp
+
+#include "phase-profile.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+namespace tourist {
+
+namespace {
+
+// Adds the allocations made between two snapshots to target
+void addAllocations(AllocationCounts& target, const AllocationCounts& now, const AllocationCounts& before) {
+    target.allocations += now.allocations - before.allocations;
+    target.deallocations += now.deallocations - before.deallocations;
+    target.bytes += now.bytes - before.bytes;
+}
+
+} // namespace
+
+const char* phaseName(Phase phase) {
+    switch (phase) {
+        case Phase::INITIALIZATION: return "initialization";
+        case Phase::OFFSPRING:      return "offspring";
+        case Phase::EVALUATION:     return "evaluation";
+        case Phase::ARCHIVE:        return "archive";
+        case Phase::SORTING:        return "sorting";
+        case Phase::CROWDING:       return "crowding";
+        case Phase::SELECTION:      return "selection";
+        case Phase::STOPPING:       return "stopping";
+        case Phase::LOGGING:        return "logging";
+        case Phase::COUNT:          break;
+    }
+    return "unknown";
+}
+
+Phase PhaseProfile::enter(Phase phase) {
+    charge(Clock::now());
+    const Phase previous = active_;
+    entered_[static_cast<size_t>(phase)] = true;
+    active_ = phase;
+    return previous;
+}
+
+void PhaseProfile::leave(Phase previous) {
+    charge(Clock::now());
+    active_ = previous;
+}
+
+void PhaseProfile::charge(Clock::time_point now) {
+    if (active_ != Phase::COUNT) {
+        current_[static_cast<size_t>(active_)] +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - started_).count();
+    }
+    started_ = now;
+    
+    if constexpr (PERF_COUNTERS_COMPILED) {
+        if (counters_) {
+            CounterValues counts;
+            counters_->read(counts);
+            if (active_ != Phase::COUNT) {
+                auto& target = current_counts_[static_cast<size_t>(active_)];
+                for (size_t c = 0; c < NUM_COUNTERS; ++c) target[c] += counts[c] - last_counts_[c];
+            }
+            last_counts_ = counts;
+        }
+    }
+    
+    if constexpr (ALLOCATION_TRACKING_COMPILED) {
+        const AllocationCounts counts = allocationCounts();
+        if (active_ != Phase::COUNT) {
+            addAllocations(current_allocations_[static_cast<size_t>(active_)], counts, last_allocations_);
+        }
+        last_allocations_ = counts;
+    }
+}
+
+void PhaseProfile::endGeneration() {
+    Row row;
+    for (size_t p = 0; p < NUM_PHASES; ++p) {
+        row[p] = entered_[p] ? current_[p] : -1;
+    }
+    generations_.push_back(row);
+    current_.fill(0);
+    entered_.fill(false);
+    
+    if (counters_) {
+        counter_rows_.push_back(current_counts_);
+        current_counts_ = CounterRow{};
+    }
+    
+    if constexpr (ALLOCATION_TRACKING_COMPILED) {
+        allocation_rows_.push_back(current_allocations_);
+        current_allocations_ = AllocationRow{};
+        
+        // Allocations made by the pushes below are counted in the next sample
+        const AllocationCounts now = allocationCounts();
+        AllocationCounts generation;
+        addAllocations(generation, now, generation_start_);
+        generation_start_ = now;
+        generation_allocations_.push_back(generation);
+        peak_resident_.push_back(peakResidentBytes());
+    }
+}
+
+void PhaseProfile::clear() {
+    current_.fill(0);
+    entered_.fill(false);
+    generations_.clear();
+    active_ = Phase::COUNT;
+    current_counts_ = CounterRow{};
+    counter_rows_.clear();
+    
+    current_allocations_ = AllocationRow{};
+    allocation_rows_.clear();
+    generation_allocations_.clear();
+    peak_resident_.clear();
+    last_allocations_ = allocationCounts();
+    generation_start_ = last_allocations_;
+}
+
+bool PhaseProfile::enableCounters() {
+    auto counters = std::make_unique<PerfCounters>();
+    if (!counters->available()) {
+        counters_error_ = counters->error();
+        return false;
+    }
+    counters_error_.clear();
+    counters->read(last_counts_);
+    counters_ = std::move(counters);
+    counter_rows_.assign(generations_.size(), CounterRow{});
+    return true;
+}
+
+AllocationCounts PhaseProfile::allocationTotals(Phase phase) const {
+    AllocationCounts totals;
+    for (const auto& row : allocation_rows_) {
+        addAllocations(totals, row[static_cast<size_t>(phase)], AllocationCounts());
+    }
+    return totals;
+}
+
+CounterValues PhaseProfile::counterTotals(Phase phase) const {
+    CounterValues totals{};
+    for (const auto& row : counter_rows_) {
+        const auto& counts = row[static_cast<size_t>(phase)];
+        for (size_t c = 0; c < NUM_COUNTERS; ++c) totals[c] += counts[c];
+    }
+    return totals;
+}
+
+// Percentiles use the nearest-rank method
+PhaseProfile::Stats PhaseProfile::stats(Phase phase) const {
+    std::vector<double> samples;
+    samples.reserve(generations_.size());
+    for (const auto& row : generations_) {
+        const auto ns = row[static_cast<size_t>(phase)];
+        if (ns >= 0) samples.push_back(ns * 1e-9);
+    }
+    
+    Stats result;
+    result.samples = samples.size();
+    if (samples.empty()) return result;
+    
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double q) {
+        size_t rank = static_cast<size_t>(std::ceil(q * samples.size()));
+        return samples[std::min(samples.size(), std::max<size_t>(rank, 1)) - 1];
+    };
+    
+    for (double s : samples) result.total += s;
+    result.min = samples.front();
+    result.max = samples.back();
+    result.median = percentile(0.5);
+    result.p99 = percentile(0.99);
+    result.mean = result.total / samples.size();
+    return result;
+}
+
+void PhaseProfile::writeReport(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open phase report: " + filename);
+    }
+    
+    file << "{\n  \"samples\": " << generations_.size() << ",\n  \"phases\": [\n";
+    file << std::setprecision(9);
+    for (size_t p = 0; p < NUM_PHASES; ++p) {
+        const Stats s = stats(static_cast<Phase>(p));
+        file << "    {\"phase\": \"" << phaseName(static_cast<Phase>(p)) << "\""
+             << ", \"samples\": " << s.samples
+             << ", \"total_seconds\": " << s.total
+             << ", \"min_seconds\": " << s.min
+             << ", \"median_seconds\": " << s.median
+             << ", \"p99_seconds\": " << s.p99
+             << ", \"max_seconds\": " << s.max
+             << ", \"mean_seconds\": " << s.mean;
+        if (ALLOCATION_TRACKING_COMPILED) {
+            const auto allocations = allocationTotals(static_cast<Phase>(p));
+            file << ", \"allocations\": " << allocations.allocations
+                 << ", \"deallocations\": " << allocations.deallocations
+                 << ", \"allocated_bytes\": " << allocations.bytes;
+        }
+        if (counters_) {
+            const auto totals = counterTotals(static_cast<Phase>(p));
+            for (size_t c = 0; c < NUM_COUNTERS; ++c) {
+                file << ", \"" << counterName(static_cast<Counter>(c)) << "\": " << totals[c];
+            }
+        }
+        file << "}" << (p + 1 < NUM_PHASES ? ",\n" : "\n");
+    }
+    
+    // Raw samples: one row per generation, phases in the order above, -1 if not run
+    file << "  ],\n  \"per_generation_ns\": [\n";
+    for (size_t g = 0; g < generations_.size(); ++g) {
+        file << "    [";
+        for (size_t p = 0; p < NUM_PHASES; ++p) {
+            file << (p > 0 ? ", " : "") << generations_[g][p];
+        }
+        file << "]" << (g + 1 < generations_.size() ? ",\n" : "\n");
+    }
+    file << "  ]";
+    
+    // Counter samples: per generation, per phase, counters in the order of "counters"
+    if (counters_) {
+        file << ",\n  \"counters\": [";
+        for (size_t c = 0; c < NUM_COUNTERS; ++c) {
+            file << (c > 0 ? ", " : "") << "\"" << counterName(static_cast<Counter>(c)) << "\"";
+        }
+        file << "],\n  \"per_generation_counters\": [\n";
+        for (size_t g = 0; g < counter_rows_.size(); ++g) {
+            file << "    [";
+            for (size_t p = 0; p < NUM_PHASES; ++p) {
+                file << (p > 0 ? ", " : "") << "[";
+                for (size_t c = 0; c < NUM_COUNTERS; ++c) {
+                    file << (c > 0 ? ", " : "") << counter_rows_[g][p][c];
+                }
+                file << "]";
+            }
+            file << "]" << (g + 1 < counter_rows_.size() ? ",\n" : "\n");
+        }
+        file << "  ]";
+    } else if (!counters_error_.empty()) {
+        file << ",\n  \"counters_error\": \"" << counters_error_ << "\"";
+    }
+    
+    // Memory samples: whole-generation allocations and peak RSS, then per-phase
+    // [allocations, deallocations, bytes] in phase order
+    if (ALLOCATION_TRACKING_COMPILED) {
+        file << ",\n  \"per_generation_memory\": [\n";
+        for (size_t g = 0; g < generation_allocations_.size(); ++g) {
+            const auto& total = generation_allocations_[g];
+            file << "    {\"allocations\": " << total.allocations
+                 << ", \"deallocations\": " << total.deallocations
+                 << ", \"allocated_bytes\": " << total.bytes
+                 << ", \"peak_rss_bytes\": " << peak_resident_[g]
+                 << ", \"phases\": [";
+            for (size_t p = 0; p < NUM_PHASES; ++p) {
+                const auto& a = allocation_rows_[g][p];
+                file << (p > 0 ? ", " : "") << "[" << a.allocations << ", " << a.deallocations << ", " << a.bytes << "]";
+            }
+            file << "]}" << (g + 1 < generation_allocations_.size() ? ",\n" : "\n");
+        }
+        file << "  ]";
+    }
+    file << "\n}\n";
+}
+
+} // namespace tourist
@@ -0,0 +1,381 @@
+// File: src/quality-indicators.cpp
+
+#include "quality-indicators.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace tourist {
+namespace utils {
+
+namespace {
+
+constexpr size_t BLOCK = 64;       // Points measured against a query per vectorized step
+constexpr size_t LEAF_SIZE = 32;   // Largest leaf of the reference index
+
+constexpr double INFINITE = std::numeric_limits<double>::infinity();
+
+// Per-objective steps of the kernels: acc is the value accumulated for a point
+// of the set, value its objective and query the query's objective
+struct SquaredDistance {
+    double operator()(double acc, double value, double query) const {
+        const double diff = value - query;
+        return acc + diff * diff;
+    }
+};
+
+// Only the objectives in which the set's point is worse than the query count (IGD+)
+struct SquaredShortfall {
+    double operator()(double acc, double value, double query) const {
+        const double diff = std::max(value - query, 0.0);
+        return acc + diff * diff;
+    }
+};
+
+struct LargestDifference {
+    double operator()(double acc, double value, double query) const {
+        return std::max(acc, value - query);
+    }
+};
+
+struct LargestRatio {
+    double operator()(double acc, double value, double query) const {
+        return std::max(acc, value / query);
+    }
+};
+
+// Smallest accumulated value over the points [begin, end) of a set, and where
+// it is reached. Each point starts at init and takes step() for every objective;
+// a block of points is processed one column at a time, without branches.
+template <typename Step>
+double minimumOver(const ObjectiveSet& set, const double* query, size_t begin, size_t end, double init,
+                   Step step, size_t* where = nullptr) {
+    const size_t d = set.dimensions();
+    double best = INFINITE;
+    size_t best_index = end;
+    double acc[BLOCK];
+    for (size_t start = begin; start < end; start += BLOCK) {
+        const size_t length = std::min(BLOCK, end - start);
+        for (size_t j = 0; j < length; ++j) acc[j] = init;
+        for (size_t i = 0; i < d; ++i) {
+            const double* column = set.column(i) + start;
+            const double q = query[i];
+            for (size_t j = 0; j < length; ++j) {
+                acc[j] = step(acc[j], column[j], q);
+            }
+        }
+        for (size_t j = 0; j < length; ++j) {
+            if (acc[j] < best) {
+                best = acc[j];
+                best_index = start + j;
+            }
+        }
+    }
+    if (where) *where = best_index;
+    return best;
+}
+
+void gather(const ObjectiveSet& set, size_t point, std::vector<double>& row) {
+    row.resize(set.dimensions());
+    for (size_t i = 0; i < row.size(); ++i) {
+        row[i] = set.value(point, i);
+    }
+}
+
+// Mean over the points of from of the square root of the smallest accumulated
+// value over the points of to
+template <typename Step>
+double meanNearest(const ObjectiveSet& from, const ObjectiveSet& to, Step step) {
+    std::vector<double> query;
+    double total = 0.0;
+    for (size_t p = 0; p < from.size(); ++p) {
+        gather(from, p, query);
+        total += std::sqrt(minimumOver(to, query.data(), 0, to.size(), 0.0, step));
+    }
+    return total / static_cast<double>(from.size());
+}
+
+// Largest over the points r of reference of the smallest over the points a of
+// front of the largest per-objective step(a_i, r_i)
+template <typename Step>
+double epsilon(const ObjectiveSet& front, const ObjectiveSet& reference, Step step) {
+    std::vector<double> query;
+    double worst = -INFINITE;
+    for (size_t r = 0; r < reference.size(); ++r) {
+        gather(reference, r, query);
+        worst = std::max(worst, minimumOver(front, query.data(), 0, front.size(), -INFINITE, step));
+    }
+    return worst;
+}
+
+void checkDimensions(const ObjectiveSet& a, const ObjectiveSet& b) {
+    if (a.dimensions() != b.dimensions()) {
+        throw std::invalid_argument("Objective sets have different numbers of objectives");
+    }
+}
+
+bool allPositive(const ObjectiveSet& set) {
+    for (size_t i = 0; i < set.dimensions(); ++i) {
+        const double* column = set.column(i);
+        if (std::any_of(column, column + set.size(), [](double value) { return !(value > 0.0); })) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+// ObjectiveSet implementation
+ObjectiveSet ObjectiveSet::fromRows(const double* values, size_t num_points, size_t num_objectives) {
+    ObjectiveSet set(num_objectives);
+    for (size_t i = 0; i < num_objectives; ++i) {
+        auto& column = set.columns_[i];
+        column.resize(num_points);
+        for (size_t p = 0; p < num_points; ++p) {
+            column[p] = values[p * num_objectives + i];
+        }
+    }
+    return set;
+}
+
+void ObjectiveSet::reserve(size_t num_points) {
+    for (auto& column : columns_) column.reserve(num_points);
+}
+
+void ObjectiveSet::add(const double* point) {
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        columns_[i].push_back(point[i]);
+    }
+}
+
+// ReferenceIndex implementation
+ReferenceIndex::ReferenceIndex(const ObjectiveSet& reference) : points_(reference.dimensions()) {
+    const size_t n = reference.size();
+    if (n > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("Too many points for a reference index");
+    }
+
+    std::vector<std::uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0u);
+    if (n > 0) build(reference, order, 0, n);
+
+    // Store the points in tree order, so every node covers a contiguous range
+    std::vector<double> row;
+    points_.reserve(n);
+    for (std::uint32_t index : order) {
+        gather(reference, index, row);
+        points_.add(row.data());
+    }
+    origin_ = std::move(order);
+}
+
+// Splits the widest objective of the range at its median
+size_t ReferenceIndex::build(const ObjectiveSet& reference, std::vector<std::uint32_t>& order,
+                             size_t begin, size_t end) {
+    const size_t node = nodes_.size();
+    nodes_.push_back(Node{begin, end});
+    if (end - begin <= LEAF_SIZE) return node;
+
+    size_t objective = 0;
+    double widest = 0.0;
+    for (size_t i = 0; i < reference.dimensions(); ++i) {
+        double low = INFINITE;
+        double high = -INFINITE;
+        for (size_t j = begin; j < end; ++j) {
+            low = std::min(low, reference.value(order[j], i));
+            high = std::max(high, reference.value(order[j], i));
+        }
+        if (high - low > widest) {
+            widest = high - low;
+            objective = i;
+        }
+    }
+    if (widest <= 0.0) return node;  // All points coincide
+
+    const size_t middle = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + middle, order.begin() + end,
+                     [&reference, objective](std::uint32_t a, std::uint32_t b) {
+                         return reference.value(a, objective) < reference.value(b, objective);
+                     });
+    const double split = reference.value(order[middle], objective);
+    const size_t left = build(reference, order, begin, middle);
+    const size_t right = build(reference, order, middle, end);
+
+    nodes_[node].objective = objective;
+    nodes_[node].split = split;
+    nodes_[node].left = left;
+    nodes_[node].right = right;
+    return node;
+}
+
+size_t ReferenceIndex::nearest(const double* query, double* distance) const {
+    size_t best = 0;
+    double best_squared = INFINITE;
+    if (!nodes_.empty()) search(0, query, best, best_squared);
+    if (distance) *distance = std::sqrt(best_squared);
+    return nodes_.empty() ? 0 : origin_[best];
+}
+
+// The far side of a split can only hold a nearer point if the query is closer
+// to the splitting plane than to the best point so far
+void ReferenceIndex::search(size_t node_index, const double* query, size_t& best, double& best_squared) const {
+    const Node& node = nodes_[node_index];
+    if (node.left == 0) {
+        size_t index;
+        double squared = minimumOver(points_, query, node.begin, node.end, 0.0, SquaredDistance(), &index);
+        if (squared < best_squared) {
+            best_squared = squared;
+            best = index;
+        }
+        return;
+    }
+
+    const double diff = query[node.objective] - node.split;
+    search(diff < 0.0 ? node.left : node.right, query, best, best_squared);
+    if (diff * diff < best_squared) {
+        search(diff < 0.0 ? node.right : node.left, query, best, best_squared);
+    }
+}
+
+// QualityIndicators implementation
+double QualityIndicators::generationalDistance(const ObjectiveSet& front, const ObjectiveSet& reference) {
+    checkDimensions(front, reference);
+    if (front.empty() || reference.empty()) return INFINITE;
+    return meanNearest(front, reference, SquaredDistance());
+}
+
+double QualityIndicators::generationalDistance(const ObjectiveSet& front, const ReferenceIndex& reference) {
+    if (front.dimensions() != reference.dimensions()) {
+        throw std::invalid_argument("Objective sets have different numbers of objectives");
+    }
+    if (front.empty() || reference.size() == 0) return INFINITE;
+
+    std::vector<double> query;
+    double total = 0.0;
+    for (size_t p = 0; p < front.size(); ++p) {
+        gather(front, p, query);
+        double distance;
+        reference.nearest(query.data(), &distance);
+        total += distance;
+    }
+    return total / static_cast<double>(front.size());
+}
+
+double QualityIndicators::invertedGenerationalDistance(const ObjectiveSet& front, const ObjectiveSet& reference) {
+    checkDimensions(front, reference);
+    if (front.empty() || reference.empty()) return INFINITE;
+    return meanNearest(reference, front, SquaredDistance());
+}
+
+double QualityIndicators::invertedGenerationalDistancePlus(const ObjectiveSet& front,
+                                                           const ObjectiveSet& reference) {
+    checkDimensions(front, reference);
+    if (front.empty() || reference.empty()) return INFINITE;
+    return meanNearest(reference, front, SquaredShortfall());
+}
+
+double QualityIndicators::additiveEpsilon(const ObjectiveSet& front, const ObjectiveSet& reference) {
+    checkDimensions(front, reference);
+    if (front.empty() || reference.empty()) return INFINITE;
+    return epsilon(front, reference, LargestDifference());
+}
+
+double QualityIndicators::multiplicativeEpsilon(const ObjectiveSet& front, const ObjectiveSet& reference) {
+    checkDimensions(front, reference);
+    if (!allPositive(front) || !allPositive(reference)) {
+        throw std::invalid_argument("The multiplicative epsilon indicator needs positive objective values");
+    }
+    if (front.empty() || reference.empty()) return INFINITE;
+    return epsilon(front, reference, LargestRatio());
+}
+
+double QualityIndicators::spread(const ObjectiveSet& front, const ObjectiveSet& reference) {
+    const size_t n = front.size();
+    const size_t d = front.dimensions();
+    if (!reference.empty()) checkDimensions(front, reference);
+    if (n == 0) return INFINITE;
+
+    // Extreme points: the best point in each objective
+    const ObjectiveSet& bounds = reference.empty() ? front : reference;
+    std::vector<std::vector<double>> extremes(d);
+    for (size_t k = 0; k < d; ++k) {
+        const double* column = bounds.column(k);
+        gather(bounds, std::min_element(column, column + bounds.size()) - column, extremes[k]);
+    }
+
+    std::vector<double> row;
+    std::vector<double> gaps;
+    double boundary = 0.0;  // Distances from the extreme points to the front
+    if (d == 2) {
+        // Deb et al. (2002): gaps between consecutive points along the first objective
+        std::vector<size_t> order(n);
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::sort(order.begin(), order.end(), [&front](size_t a, size_t b) {
+            return front.value(a, 0) < front.value(b, 0) ||
+                   (front.value(a, 0) == front.value(b, 0) && front.value(a, 1) < front.value(b, 1));
+        });
+        for (size_t j = 1; j < n; ++j) {
+            gaps.push_back(std::hypot(front.value(order[j], 0) - front.value(order[j - 1], 0),
+                                      front.value(order[j], 1) - front.value(order[j - 1], 1)));
+        }
+        boundary = std::hypot(extremes[0][0] - front.value(order.front(), 0),
+                              extremes[0][1] - front.value(order.front(), 1)) +
+                   std::hypot(extremes[1][0] - front.value(order.back(), 0),
+                              extremes[1][1] - front.value(order.back(), 1));
+    } else {
+        // Zhou et al. (2006): each point's distance to its nearest neighbor
+        if (n > 1) {
+            for (size_t p = 0; p < n; ++p) {
+                gather(front, p, row);
+                double squared = std::min(minimumOver(front, row.data(), 0, p, 0.0, SquaredDistance()),
+                                          minimumOver(front, row.data(), p + 1, n, 0.0, SquaredDistance()));
+                gaps.push_back(std::sqrt(squared));
+            }
+        }
+        for (const auto& extreme : extremes) {
+            boundary += std::sqrt(minimumOver(front, extreme.data(), 0, n, 0.0, SquaredDistance()));
+        }
+    }
+
+    double mean = gaps.empty() ? 0.0 : std::accumulate(gaps.begin(), gaps.end(), 0.0) / gaps.size();
+    double deviation = 0.0;
+    for (double gap : gaps) deviation += std::abs(gap - mean);
+    const double denominator = boundary + gaps.size() * mean;
+    return denominator > 0.0 ? (boundary + deviation) / denominator : 0.0;
+}
+
+// A weakly dominates b exactly when the largest a_i - b_i is not positive
+double QualityIndicators::coverage(const ObjectiveSet& a, const ObjectiveSet& b) {
+    checkDimensions(a, b);
+    if (a.empty() || b.empty()) return 0.0;
+
+    std::vector<double> query;
+    size_t covered = 0;
+    for (size_t p = 0; p < b.size(); ++p) {
+        gather(b, p, query);
+        if (minimumOver(a, query.data(), 0, a.size(), -INFINITE, LargestDifference()) <= 0.0) {
+            ++covered;
+        }
+    }
+    return static_cast<double>(covered) / static_cast<double>(b.size());
+}
+
+IndicatorValues QualityIndicators::evaluate(const ObjectiveSet& front, const ObjectiveSet& reference,
+                                            const ReferenceIndex* index) {
+    IndicatorValues values;
+    values.gd = index ? generationalDistance(front, *index) : generationalDistance(front, reference);
+    values.igd = invertedGenerationalDistance(front, reference);
+    values.igd_plus = invertedGenerationalDistancePlus(front, reference);
+    values.epsilon_additive = additiveEpsilon(front, reference);
+    values.epsilon_multiplicative = allPositive(front) && allPositive(reference)
+                                        ? multiplicativeEpsilon(front, reference)
+                                        : std::numeric_limits<double>::quiet_NaN();
+    values.spread = spread(front, reference);
+    return values;
+}
+
+} // namespace utils
+} // namespace tourist
@@ -0,0 +1,344 @@
+// File: src/results-format.cpp
+
+#include "results-format.hpp"
+#include "models.hpp"
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace tourist {
+
+namespace {
+
+constexpr char MAGIC[8] = {'T', 'R', 'R', 'S', 'L', 'T', '0', '1'};
+constexpr std::uint32_t FORMAT_VERSION = 2;
+constexpr size_t COLUMN_ALIGNMENT = 8;
+constexpr size_t HEADER_SIZE = 32;
+
+// Same checksum as the checkpoint format
+std::uint64_t fnv1a(const char* data, size_t size) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Assigns dictionary ids to names in order of first appearance
+class Dictionary {
+public:
+    explicit Dictionary(std::vector<std::string>& entries) : entries_(entries) {}
+
+    std::uint16_t id(const std::string& name) {
+        auto it = ids_.find(name);
+        if (it != ids_.end()) return it->second;
+        if (entries_.size() > UINT16_MAX) {
+            throw std::runtime_error("Too many distinct names for the results dictionary");
+        }
+        auto new_id = static_cast<std::uint16_t>(entries_.size());
+        entries_.push_back(name);
+        ids_.emplace(name, new_id);
+        return new_id;
+    }
+
+private:
+    std::vector<std::string>& entries_;
+    std::unordered_map<std::string, std::uint16_t> ids_;
+};
+
+class Writer {
+public:
+    template <typename T>
+    void value(const T& v) {
+        const auto* bytes = reinterpret_cast<const char*>(&v);
+        buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+    }
+
+    template <typename T>
+    void column(const std::vector<T>& values) {
+        align();
+        const auto* bytes = reinterpret_cast<const char*>(values.data());
+        buffer_.insert(buffer_.end(), bytes, bytes + values.size() * sizeof(T));
+    }
+
+    void bytes(const std::string& s) {
+        buffer_.insert(buffer_.end(), s.begin(), s.end());
+    }
+
+    void align() {
+        buffer_.resize((buffer_.size() + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT * COLUMN_ALIGNMENT, 0);
+    }
+
+    const std::vector<char>& buffer() const { return buffer_; }
+
+private:
+    std::vector<char> buffer_;
+};
+
+// Sequential reader over the first end bytes of a loaded file
+class Reader {
+public:
+    Reader(const std::vector<char>& buffer, size_t end) : buffer_(buffer), end_(end) {}
+
+    template <typename T>
+    T value() {
+        T v;
+        std::memcpy(&v, take(sizeof(T)), sizeof(T));
+        return v;
+    }
+
+    template <typename T>
+    std::vector<T> column(size_t count) {
+        pos_ = (pos_ + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT * COLUMN_ALIGNMENT;
+        if (count > (end_ - std::min(pos_, end_)) / sizeof(T)) {
+            throw std::runtime_error("Truncated results file");
+        }
+        std::vector<T> values(count);
+        std::memcpy(values.data(), take(count * sizeof(T)), count * sizeof(T));
+        return values;
+    }
+
+    std::string bytes(size_t count) {
+        const char* data = take(count);
+        return std::string(data, count);
+    }
+
+private:
+    const char* take(size_t size) {
+        if (pos_ > end_ || size > end_ - pos_) {
+            throw std::runtime_error("Truncated results file");
+        }
+        const char* data = buffer_.data() + pos_;
+        pos_ += size;
+        return data;
+    }
+
+    const std::vector<char>& buffer_;
+    size_t end_;
+    size_t pos_{0};
+};
+
+void checkOffsets(const std::vector<std::uint32_t>& offsets, size_t total) {
+    for (size_t i = 1; i < offsets.size(); ++i) {
+        if (offsets[i] < offsets[i - 1]) throw std::runtime_error("Invalid offsets in results file");
+    }
+    if (offsets.front() != 0 || offsets.back() != total) {
+        throw std::runtime_error("Invalid offsets in results file");
+    }
+}
+
+void checkIds(const std::vector<std::uint16_t>& ids, size_t dictionary_size) {
+    for (auto id : ids) {
+        if (id >= dictionary_size) throw std::runtime_error("Invalid dictionary id in results file");
+    }
+}
+
+} // namespace
+
+ResultsTable ResultsTable::fromSolutions(const std::vector<Solution>& solutions, double day_start) {
+    ResultsTable table;
+    Dictionary dictionary(table.dictionary);
+    
+    const size_t n = solutions.size();
+    table.cost.reserve(n);
+    table.time.reserve(n);
+    table.start_time.reserve(n);
+    table.end_time.reserve(n);
+    table.attractions.reserve(n);
+    table.neighborhoods.reserve(n);
+    table.stop_offsets.reserve(n + 1);
+    table.neighborhood_offsets.reserve(n + 1);
+    table.stop_offsets.push_back(0);
+    table.neighborhood_offsets.push_back(0);
+    
+    for (const auto& solution : solutions) {
+        const auto& objectives = solution.getObjectives();
+        const auto& route = solution.getRoute();
+        const auto& attractions = route.getAttractions();
+        const auto& modes = route.getTransportModes();
+        const auto& time_info = route.getTimeInfo();
+        
+        table.cost.push_back(objectives[0]);
+        table.time.push_back(objectives[1]);
+        table.start_time.push_back(day_start);
+        table.end_time.push_back(day_start + route.getTotalTime());
+        table.attractions.push_back(static_cast<std::uint16_t>(attractions.size()));
+        
+        for (size_t j = 0; j < attractions.size(); ++j) {
+            table.stop_names.push_back(dictionary.id(attractions[j]->getName()));
+            table.arrival_times.push_back(j < time_info.size() ? time_info[j].arrival_time : 0.0);
+            table.departure_times.push_back(j < time_info.size() ? time_info[j].departure_time : 0.0);
+            table.arrival_modes.push_back(j > 0 && j - 1 < modes.size() ?
+                                          static_cast<std::uint8_t>(modes[j - 1]) : NO_MODE);
+        }
+        table.stop_offsets.push_back(static_cast<std::uint32_t>(table.stop_names.size()));
+        
+        // Same iteration order as the CSV export has always used
+        std::unordered_set<std::string> neighborhoods;
+        for (const auto* attraction : attractions) {
+            neighborhoods.insert(attraction->getNeighborhood());
+        }
+        for (const auto& neighborhood : neighborhoods) {
+            table.neighborhood_names.push_back(dictionary.id(neighborhood));
+        }
+        table.neighborhoods.push_back(static_cast<std::uint16_t>(neighborhoods.size()));
+        table.neighborhood_offsets.push_back(static_cast<std::uint32_t>(table.neighborhood_names.size()));
+    }
+    
+    return table;
+}
+
+void ResultsFormat::write(const ResultsTable& table, const std::string& filename) {
+    Writer writer;
+    writer.bytes(std::string(MAGIC, sizeof(MAGIC)));
+    writer.value(FORMAT_VERSION);
+    writer.value(static_cast<std::uint32_t>(table.size()));
+    writer.value(static_cast<std::uint32_t>(table.stop_names.size()));
+    writer.value(static_cast<std::uint32_t>(table.neighborhood_names.size()));
+    writer.value(static_cast<std::uint32_t>(table.dictionary.size()));
+    writer.value(std::uint32_t(0));
+    
+    for (const auto& name : table.dictionary) {
+        writer.value(static_cast<std::uint32_t>(name.size()));
+        writer.bytes(name);
+    }
+    
+    writer.column(table.cost);
+    writer.column(table.time);
+    writer.column(table.start_time);
+    writer.column(table.end_time);
+    writer.column(table.attractions);
+    writer.column(table.neighborhoods);
+    writer.column(table.stop_offsets);
+    writer.column(table.stop_names);
+    writer.column(table.arrival_times);
+    writer.column(table.departure_times);
+    writer.column(table.arrival_modes);
+    writer.column(table.neighborhood_offsets);
+    writer.column(table.neighborhood_names);
+    writer.align();
+    writer.value(fnv1a(writer.buffer().data(), writer.buffer().size()));
+    
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Erro ao criar arquivo: " + filename);
+    }
+    const auto& buffer = writer.buffer();
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!file) {
+        throw std::runtime_error("Erro ao escrever arquivo: " + filename);
+    }
+}
+
+ResultsTable ResultsFormat::read(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Erro ao abrir arquivo: " + filename);
+    }
+    std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (buffer.size() < HEADER_SIZE + sizeof(std::uint64_t) ||
+        std::memcmp(buffer.data(), MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a results file: " + filename);
+    }
+    
+    const size_t payload_size = buffer.size() - sizeof(std::uint64_t);
+    std::uint64_t checksum;
+    std::memcpy(&checksum, buffer.data() + payload_size, sizeof(checksum));
+    if (checksum != fnv1a(buffer.data(), payload_size)) {
+        throw std::runtime_error("Corrupt results file: " + filename);
+    }
+    
+    Reader reader(buffer, payload_size);
+    reader.bytes(sizeof(MAGIC));
+    if (reader.value<std::uint32_t>() != FORMAT_VERSION) {
+        throw std::runtime_error("Unsupported results format version: " + filename);
+    }
+    const auto n = reader.value<std::uint32_t>();
+    const auto stops = reader.value<std::uint32_t>();
+    const auto neighborhood_refs = reader.value<std::uint32_t>();
+    const auto dictionary_size = reader.value<std::uint32_t>();
+    reader.value<std::uint32_t>();  // Reserved
+    
+    ResultsTable table;
+    table.dictionary.reserve(std::min<size_t>(dictionary_size, buffer.size()));
+    for (std::uint32_t i = 0; i < dictionary_size; ++i) {
+        table.dictionary.push_back(reader.bytes(reader.value<std::uint32_t>()));
+    }
+    
+    table.cost = reader.column<double>(n);
+    table.time = reader.column<double>(n);
+    table.start_time = reader.column<double>(n);
+    table.end_time = reader.column<double>(n);
+    table.attractions = reader.column<std::uint16_t>(n);
+    table.neighborhoods = reader.column<std::uint16_t>(n);
+    table.stop_offsets = reader.column<std::uint32_t>(size_t(n) + 1);
+    table.stop_names = reader.column<std::uint16_t>(stops);
+    table.arrival_times = reader.column<double>(stops);
+    table.departure_times = reader.column<double>(stops);
+    table.arrival_modes = reader.column<std::uint8_t>(stops);
+    table.neighborhood_offsets = reader.column<std::uint32_t>(size_t(n) + 1);
+    table.neighborhood_names = reader.column<std::uint16_t>(neighborhood_refs);
+    
+    checkOffsets(table.stop_offsets, stops);
+    checkOffsets(table.neighborhood_offsets, neighborhood_refs);
+    checkIds(table.stop_names, table.dictionary.size());
+    checkIds(table.neighborhood_names, table.dictionary.size());
+    
+    return table;
+}
+
+void ResultsFormat::writeCsv(const ResultsTable& table, const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Erro ao criar arquivo: " + filename);
+    }
+    
+    file << "Solucao;CustoTotal;TempoTotal;NumAtracoes;NumBairros;HoraInicio;HoraFim;Bairros;Sequencia;TemposChegada;TemposPartida;ModosTransporte\n";
+    file << std::fixed << std::setprecision(2);
+    
+    for (size_t i = 0; i < table.size(); ++i) {
+        const size_t stop_begin = table.stop_offsets[i];
+        const size_t stop_end = table.stop_offsets[i + 1];
+        
+        file << (i + 1) << ";";
+        file << table.cost[i] << ";";
+        file << table.time[i] << ";";
+        file << table.attractions[i] << ";";
+        file << table.neighborhoods[i] << ";";
+        file << utils::Transport::formatTime(table.start_time[i]) << ";";
+        file << utils::Transport::formatTime(table.end_time[i]) << ";";
+        
+        for (size_t j = table.neighborhood_offsets[i]; j < table.neighborhood_offsets[i + 1]; ++j) {
+            file << table.dictionary[table.neighborhood_names[j]] << "|";
+        }
+        file << ";";
+        
+        for (size_t j = stop_begin; j < stop_end; ++j) {
+            file << table.dictionary[table.stop_names[j]] << "|";
+        }
+        file << ";";
+        
+        for (size_t j = stop_begin; j < stop_end; ++j) {
+            file << utils::Transport::formatTime(table.arrival_times[j]) << "|";
+        }
+        file << ";";
+        
+        for (size_t j = stop_begin; j < stop_end; ++j) {
+            file << utils::Transport::formatTime(table.departure_times[j]) << "|";
+        }
+        file << ";";
+        
+        for (size_t j = stop_begin; j < stop_end; ++j) {
+            if (table.arrival_modes[j] == ResultsTable::NO_MODE) continue;
+            file << utils::Transport::getModeString(static_cast<utils::TransportMode>(table.arrival_modes[j])) << "|";
+        }
+        file << "\n";
+    }
+}
+
+} // namespace tourist
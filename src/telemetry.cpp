@@ -0,0 +1,130 @@
+// File: src/telemetry.cpp
+
+#include "telemetry.hpp"
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+
+namespace tourist {
+
+// ConsoleSink implementation
+void ConsoleSink::onGeneration(const GenerationRecord& record) {
+    std::ostringstream line;
+    line << "Generation " << record.generation
+         << ": Front size = " << record.front_size;
+    if (record.has_feasible) {
+        line << ", Best solution: [Cost=" << std::fixed << std::setprecision(2) << record.best_cost
+             << ", Time=" << std::fixed << std::setprecision(1) << record.best_time
+             << ", Attractions=" << record.max_attractions
+             << ", Neighborhoods=" << record.max_neighborhoods << "]";
+    } else if (record.front_size > 0) {
+        line << ", No valid solutions yet";
+    }
+    line << '\n';
+    buffer_ += line.str();
+}
+
+void ConsoleSink::flush() {
+    if (buffer_.empty()) return;
+    std::cout.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    std::cout.flush();
+    buffer_.clear();
+}
+
+void ConsoleSink::onRunEnd(const RunSummary& summary) {
+    if (summary.stopped_early) {
+        std::cout << "Stopping at generation " << (summary.generations - 1) << ": "
+                  << summary.stop_reason << std::endl;
+    }
+}
+
+// CsvSink implementation
+void CsvSink::onRunStart(bool resuming) {
+    std::error_code error;
+    const bool append = resuming && std::filesystem::file_size(path_, error) > 0 && !error;
+    file_.open(path_, append ? std::ios::app : std::ios::out);
+    if (file_.is_open() && !append) {
+        file_ << "Generation;Front size;Best Cost;Best Time;Max Attractions;Hypervolume\n";
+    }
+}
+
+void CsvSink::onGeneration(const GenerationRecord& record) {
+    // Only generations with a valid first-front member are recorded
+    if (!file_.is_open() || !record.has_feasible) return;
+    
+    std::ostringstream line;
+    line << record.generation << ";"
+         << record.front_size << ";"
+         << record.best_cost << ";"
+         << record.best_time << ";"
+         << record.max_attractions << ";"
+         << record.hypervolume << '\n';
+    buffer_ += line.str();
+}
+
+void CsvSink::flush() {
+    if (buffer_.empty()) return;
+    file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    file_.flush();
+    buffer_.clear();
+}
+
+void CsvSink::onRunEnd(const RunSummary& summary) {
+    (void)summary;
+    if (file_.is_open()) {
+        file_.close();
+    }
+}
+
+// TelemetryWriter implementation
+TelemetryWriter::TelemetryWriter(std::vector<std::shared_ptr<TelemetrySink>> sinks)
+    : sinks_(std::move(sinks)) {
+    thread_ = std::thread(&TelemetryWriter::consume, this);
+}
+
+TelemetryWriter::~TelemetryWriter() {
+    close();
+}
+
+void TelemetryWriter::publish(const GenerationRecord& record) {
+    while (!ring_.push(record)) {
+        std::this_thread::yield();
+    }
+}
+
+void TelemetryWriter::close() {
+    if (!thread_.joinable()) return;
+    stop_.store(true, std::memory_order_release);
+    thread_.join();
+}
+
+void TelemetryWriter::consume() {
+    while (!stop_.load(std::memory_order_acquire)) {
+        drain();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    
+    // Records published before close() are still delivered
+    drain();
+}
+
+void TelemetryWriter::drain() {
+    GenerationRecord record;
+    bool any = false;
+    while (ring_.pop(record)) {
+        for (auto& sink : sinks_) {
+            sink->onGeneration(record);
+        }
+        any = true;
+    }
+    
+    if (any) {
+        for (auto& sink : sinks_) {
+            sink->flush();
+        }
+    }
+}
+
+} // namespace tourist
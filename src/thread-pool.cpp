@@ -0,0 +1,86 @@
+// File: src/thread-pool.cpp
+
+#include "thread-pool.hpp"
+#include <algorithm>
+
+namespace tourist {
+namespace utils {
+
+ThreadPool::ThreadPool(size_t threads) {
+    threads = resolve(threads);
+    threads_.reserve(threads - 1);
+    for (size_t worker = 1; worker < threads; ++worker) {
+        threads_.emplace_back(&ThreadPool::work, this, worker);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) thread.join();
+}
+
+size_t ThreadPool::resolve(size_t threads) {
+    return threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threads;
+}
+
+void ThreadPool::run(size_t count, const std::function<void(size_t, size_t)>& task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        count_ = count;
+        next_.store(0, std::memory_order_relaxed);
+        busy_ = threads_.size();
+        error_ = nullptr;
+        ++round_;
+    }
+    wake_.notify_all();
+    drain(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return busy_ == 0; });
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, size_t threads, const std::function<void(size_t)>& task) {
+    ThreadPool pool(std::max<size_t>(1, std::min(resolve(threads), count)));
+    pool.run(count, [&task](size_t index, size_t) { task(index); });
+}
+
+void ThreadPool::drain(size_t worker) {
+    for (size_t index = next_.fetch_add(1); index < count_; index = next_.fetch_add(1)) {
+        try {
+            (*task_)(index, worker);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_) error_ = std::current_exception();
+        }
+    }
+}
+
+void ThreadPool::work(size_t worker) {
+    size_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this, seen] { return stopping_ || round_ != seen; });
+            if (stopping_) return;
+            seen = round_;
+        }
+        drain(worker);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busy_ == 0) done_.notify_one();
+        }
+    }
+}
+
+} // namespace utils
+} // namespace tourist
@@ -0,0 +1,78 @@
+// File: tests/brute-force-hypervolume.hpp
+// Reference hypervolume by counting the cells of the grid spanned by the points
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+namespace tourist {
+namespace test {
+
+/**
+ * @brief Exact hypervolume by enumeration of grid cells
+ *
+ * Every objective is turned into a minimized one (bit i of maximize_mask set:
+ * objective i is negated). The distinct coordinates of the points that
+ * dominate the reference point, together with the reference point itself,
+ * split the dominated region into boxes; a box is dominated iff some point
+ * weakly dominates its lower corner, and the volume is the sum of the
+ * dominated boxes. Costs O(n^(d+1)), so only meant for small sets.
+ */
+inline double bruteForceHypervolume(const std::vector<std::vector<double>>& points,
+                                    const std::vector<double>& reference_point,
+                                    unsigned maximize_mask) {
+    const size_t d = reference_point.size();
+    auto oriented = [maximize_mask](double value, size_t objective) {
+        return (maximize_mask >> objective & 1u) ? -value : value;
+    };
+
+    std::vector<double> reference(d);
+    for (size_t i = 0; i < d; ++i) reference[i] = oriented(reference_point[i], i);
+
+    std::vector<std::vector<double>> inside;
+    for (const auto& point : points) {
+        std::vector<double> p(d);
+        bool dominates = true;
+        for (size_t i = 0; i < d; ++i) {
+            p[i] = oriented(point[i], i);
+            dominates = dominates && p[i] < reference[i];
+        }
+        if (dominates) inside.push_back(p);
+    }
+    if (inside.empty()) return 0.0;
+
+    std::vector<std::vector<double>> grid(d);
+    for (size_t i = 0; i < d; ++i) {
+        for (const auto& p : inside) grid[i].push_back(p[i]);
+        grid[i].push_back(reference[i]);
+        std::sort(grid[i].begin(), grid[i].end());
+        grid[i].erase(std::unique(grid[i].begin(), grid[i].end()), grid[i].end());
+    }
+
+    // Mixed-radix counter over the boxes [grid[i][c[i]], grid[i][c[i] + 1])
+    std::vector<size_t> cell(d, 0);
+    double volume = 0.0;
+    while (true) {
+        bool dominated = false;
+        for (size_t k = 0; k < inside.size() && !dominated; ++k) {
+            dominated = true;
+            for (size_t i = 0; i < d && dominated; ++i) {
+                dominated = inside[k][i] <= grid[i][cell[i]];
+            }
+        }
+        if (dominated) {
+            double box = 1.0;
+            for (size_t i = 0; i < d; ++i) box *= grid[i][cell[i] + 1] - grid[i][cell[i]];
+            volume += box;
+        }
+
+        size_t i = 0;
+        while (i < d && ++cell[i] + 1 == grid[i].size()) cell[i++] = 0;
+        if (i == d) break;
+    }
+    return volume;
+}
+
+} // namespace test
+} // namespace tourist
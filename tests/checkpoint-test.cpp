@@ -0,0 +1,111 @@
+// File: tests/checkpoint-test.cpp
+// Round trip of the binary checkpoint format and rejection of damaged files
+
+#include "checkpoint.hpp"
+#include "test-support.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace tourist;
+
+namespace {
+
+CheckpointData sampleData() {
+    CheckpointData data;
+    data.record_size = 24;
+    data.parameter_hash = 0x0123456789abcdefULL;
+    data.generation = 42;
+    data.evaluations = 4321;
+    data.rng_state = "5489 1 2 3";
+    for (size_t i = 0; i < 3 * data.record_size; ++i) data.records.push_back(static_cast<unsigned char>(i));
+    for (size_t i = 0; i < 2 * data.record_size; ++i) data.archive.push_back(static_cast<unsigned char>(255 - i));
+    return data;
+}
+
+bool sameData(const CheckpointData& a, const CheckpointData& b) {
+    return a.record_size == b.record_size && a.parameter_hash == b.parameter_hash &&
+           a.generation == b.generation && a.evaluations == b.evaluations &&
+           a.rng_state == b.rng_state && a.records == b.records && a.archive == b.archive;
+}
+
+std::vector<char> readBytes(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const std::string& path, const std::vector<char>& bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+void testRoundTrip() {
+    const std::string path = "checkpoint-roundtrip.bin";
+    const auto data = sampleData();
+    Checkpoint::write(path, data);
+    
+    CheckpointData loaded;
+    CHECK(Checkpoint::read(path, loaded));
+    CHECK(sameData(data, loaded));
+    CHECK(loaded.recordCount() == 3);
+    CHECK(loaded.archiveCount() == 2);
+    std::remove(path.c_str());
+}
+
+void testMissingFile() {
+    CheckpointData loaded;
+    CHECK(!Checkpoint::read("checkpoint-that-does-not-exist.bin", loaded));
+}
+
+// Every flipped byte and every truncation must be rejected, whichever field it hits
+void testCorruption() {
+    const std::string path = "checkpoint-corrupt.bin";
+    Checkpoint::write(path, sampleData());
+    const auto original = readBytes(path);
+    CHECK(!original.empty());
+    
+    for (size_t i = 0; i < original.size(); ++i) {
+        auto damaged = original;
+        damaged[i] = static_cast<char>(damaged[i] ^ 0x10);
+        writeBytes(path, damaged);
+        CheckpointData loaded;
+        CHECK_THROWS(Checkpoint::read(path, loaded));
+    }
+    
+    for (size_t size = 0; size < original.size(); ++size) {
+        writeBytes(path, std::vector<char>(original.begin(), original.begin() + size));
+        CheckpointData loaded;
+        CHECK_THROWS(Checkpoint::read(path, loaded));
+    }
+    std::remove(path.c_str());
+}
+
+// Snapshots submitted to the writer are on disk once it is closed, the latest one winning
+void testWriter() {
+    const std::string path = "checkpoint-writer.bin";
+    auto data = sampleData();
+    {
+        CheckpointWriter writer(path);
+        writer.submit(data);
+        data.generation = 43;
+        writer.submit(data);
+        writer.close();
+    }
+    
+    CheckpointData loaded;
+    CHECK(Checkpoint::read(path, loaded));
+    CHECK(sameData(data, loaded));
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+int main() {
+    testRoundTrip();
+    testMissingFile();
+    testCorruption();
+    testWriter();
+    return test::testResult();
+}
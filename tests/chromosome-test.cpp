@@ -0,0 +1,209 @@
+// File: tests/chromosome-test.cpp
+// Fixed-capacity chromosomes: the bitmask follows every edit of the genes, the
+// reverse hash matches the reversed chromosome, and sets keep their members
+
+#include "chromosome.hpp"
+#include "test-support.hpp"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+using namespace tourist;
+
+namespace {
+
+using Chromosome = FixedChromosome<8>;
+using WideChromosome = FixedChromosome<4, 1000>;
+
+static_assert(std::is_trivially_copyable<Chromosome>::value, "Chromosomes are copied bytewise");
+static_assert(sizeof(Chromosome::Gene) == 1 && sizeof(WideChromosome::Gene) == 2,
+              "Gene ids use the narrowest type that holds them");
+
+// The mask must hold exactly the genes in the sequence
+template <typename C>
+bool maskMatches(const C& chromosome) {
+    size_t present = 0;
+    for (size_t gene = 0; gene < C::MAX_GENES; ++gene) {
+        if (chromosome.contains(gene)) ++present;
+    }
+    if (present != chromosome.size()) return false;
+    for (auto gene : chromosome) {
+        if (!chromosome.contains(gene)) return false;
+    }
+    return true;
+}
+
+void testConstruction() {
+    const Chromosome chromosome({3, 0, 7, 255});
+    CHECK(chromosome.size() == 4);
+    CHECK(chromosome.toVector() == std::vector<int>({3, 0, 7, 255}));
+    CHECK(maskMatches(chromosome));
+    CHECK(!chromosome.contains(1));
+    CHECK(!chromosome.contains(256));
+
+    CHECK_THROWS(Chromosome({1, 2, 1}));
+    CHECK_THROWS(Chromosome({-1}));
+    CHECK_THROWS(Chromosome({256}));
+    CHECK_THROWS(Chromosome({0, 1, 2, 3, 4, 5, 6, 7, 8}));
+
+    const WideChromosome wide({999, 64, 128});
+    CHECK(wide.contains(999) && wide.contains(64) && !wide.contains(65));
+    CHECK(maskMatches(wide));
+}
+
+void testEdits() {
+    Chromosome chromosome;
+    CHECK(chromosome.empty());
+    CHECK(chromosome.push_back(5));
+    CHECK(!chromosome.push_back(5));
+    CHECK(chromosome.insert(0, 9));
+    CHECK(chromosome.insert(1, 2));
+    CHECK(!chromosome.insert(4, 1));
+    CHECK(chromosome.toVector() == std::vector<int>({9, 2, 5}));
+
+    CHECK(chromosome.erase(1) == 2);
+    CHECK(!chromosome.contains(2));
+    CHECK(chromosome.push_back(2));
+    chromosome.swap(0, 2);
+    CHECK(chromosome.toVector() == std::vector<int>({2, 5, 9}));
+    CHECK(maskMatches(chromosome));
+
+    chromosome.truncate(1);
+    CHECK(chromosome.toVector() == std::vector<int>({2}));
+    CHECK(maskMatches(chromosome));
+
+    for (int gene = 10; gene < 20; ++gene) chromosome.push_back(static_cast<Chromosome::Gene>(gene));
+    CHECK(chromosome.full());
+    CHECK(chromosome.size() == Chromosome::CAPACITY);
+    CHECK(maskMatches(chromosome));
+
+    chromosome.clear();
+    CHECK(chromosome.empty());
+    CHECK(maskMatches(chromosome));
+}
+
+// Random edits mirrored on a plain vector
+void testRandomEdits() {
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> gene(0, 40);
+    Chromosome chromosome;
+    std::vector<int> mirror;
+    for (size_t step = 0; step < 5000; ++step) {
+        const int g = gene(rng);
+        switch (rng() % 3) {
+            case 0: {
+                const size_t pos = rng() % (mirror.size() + 1);
+                const bool fits = mirror.size() < Chromosome::CAPACITY &&
+                                  std::find(mirror.begin(), mirror.end(), g) == mirror.end();
+                CHECK(chromosome.insert(pos, static_cast<Chromosome::Gene>(g)) == fits);
+                if (fits) mirror.insert(mirror.begin() + pos, g);
+                break;
+            }
+            case 1:
+                if (!mirror.empty()) {
+                    const size_t pos = rng() % mirror.size();
+                    CHECK(chromosome.erase(pos) == mirror[pos]);
+                    mirror.erase(mirror.begin() + pos);
+                }
+                break;
+            default:
+                if (mirror.size() > 1) {
+                    const size_t a = rng() % mirror.size();
+                    const size_t b = rng() % mirror.size();
+                    chromosome.swap(a, b);
+                    std::swap(mirror[a], mirror[b]);
+                }
+                break;
+        }
+        CHECK(chromosome.toVector() == mirror);
+        CHECK(maskMatches(chromosome));
+    }
+}
+
+void testEquality() {
+    const Chromosome a({1, 2, 3});
+    Chromosome b({1, 2, 3, 4});
+    CHECK(a != b);
+    b.truncate(3);
+    CHECK(a == b);
+    CHECK(a.reversed() == Chromosome({3, 2, 1}));
+    CHECK(a.reversed().reversed() == a);
+}
+
+Chromosome randomChromosome(std::mt19937& rng, size_t max_size) {
+    std::uniform_int_distribution<int> gene(0, 30);
+    Chromosome chromosome;
+    const size_t size = rng() % (max_size + 1);
+    while (chromosome.size() < size) chromosome.push_back(static_cast<Chromosome::Gene>(gene(rng)));
+    return chromosome;
+}
+
+// The reverse hash of a chromosome is the forward hash of its reverse
+void testHashes() {
+    std::mt19937 rng(9);
+    for (size_t round = 0; round < 2000; ++round) {
+        const Chromosome chromosome = randomChromosome(rng, Chromosome::CAPACITY);
+        const auto hashes = chromosome.hashes();
+        CHECK(hashes.first == chromosome.hash());
+        CHECK(hashes.second == chromosome.reversed().hash());
+        CHECK(chromosome.reversed().hashes().second == hashes.first);
+    }
+
+    // Sequences that differ only in order or length hash differently
+    CHECK(Chromosome({1, 2}).hash() != Chromosome({2, 1}).hash());
+    CHECK(Chromosome({0}).hash() != Chromosome().hash());
+    CHECK(Chromosome({7}).hashes().first == Chromosome({7}).hashes().second);
+}
+
+// Members stay findable across every doubling of the table, and equal hashes
+// of different chromosomes are told apart by their genes
+void testSet() {
+    std::mt19937 rng(21);
+    ChromosomeSet<Chromosome> set;
+    std::set<std::vector<int>> members;
+    std::vector<Chromosome> inserted;
+    for (size_t round = 0; round < 3000; ++round) {
+        const Chromosome chromosome = randomChromosome(rng, 4);
+        const bool fresh = members.insert(chromosome.toVector()).second;
+        CHECK(set.insert(chromosome.hash(), chromosome) == fresh);
+        if (fresh) inserted.push_back(chromosome);
+        CHECK(set.size() == members.size());
+
+        // Check everything right after each doubling, which the insertion of
+        // member 2^k + 1 triggers (the table is kept at most half full)
+        const size_t size = set.size();
+        if (fresh && size > 32 && ((size - 1) & (size - 2)) == 0) {
+            for (const auto& member : inserted) CHECK(set.contains(member.hash(), member));
+        }
+    }
+    for (const auto& member : inserted) CHECK(set.contains(member.hash(), member));
+    CHECK(!set.contains(Chromosome({29, 30, 28, 27, 26}).hash(), Chromosome({29, 30, 28, 27, 26})));
+
+    ChromosomeSet<Chromosome> colliding;
+    for (int gene = 0; gene < 100; ++gene) {
+        CHECK(colliding.insert(42, Chromosome({gene})));
+    }
+    CHECK(!colliding.insert(42, Chromosome({5})));
+    CHECK(colliding.size() == 100);
+    for (int gene = 0; gene < 100; ++gene) CHECK(colliding.contains(42, Chromosome({gene})));
+    CHECK(!colliding.contains(42, Chromosome({100})));
+
+    colliding.clear();
+    CHECK(colliding.size() == 0);
+    CHECK(!colliding.contains(42, Chromosome({5})));
+    CHECK(colliding.insert(42, Chromosome({5})));
+}
+
+} // namespace
+
+int main() {
+    testConstruction();
+    testEdits();
+    testRandomEdits();
+    testEquality();
+    testHashes();
+    testSet();
+    return test::testResult();
+}
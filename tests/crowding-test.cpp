@@ -0,0 +1,145 @@
+// File: tests/crowding-test.cpp
+// Crowding distances over index permutations, checked against the former
+// calculateCrowdingDistances, which sorted the front itself once per objective
+
+#include "crowding.hpp"
+#include "test-support.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace tourist;
+
+namespace {
+
+using Rows = std::vector<std::vector<double>>;
+
+constexpr double INFINITE = std::numeric_limits<double>::infinity();
+
+const std::vector<double>& compute(CrowdingDistance& crowding, const Rows& rows) {
+    const size_t n = rows.size();
+    const size_t m = rows.empty() ? 0 : rows[0].size();
+    double* columns = crowding.reset(n, m);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t obj = 0; obj < m; ++obj) columns[obj * n + i] = rows[i][obj];
+    }
+    return crowding.compute();
+}
+
+// The former NSGA2Base::calculateCrowdingDistances, on plain rows
+std::vector<double> formerCrowding(const Rows& rows) {
+    const size_t n = rows.size();
+    std::vector<double> distances(n, 0.0);
+    if (n <= 1) {
+        if (n == 1) distances[0] = INFINITE;
+        return distances;
+    }
+
+    std::vector<size_t> front(n);
+    for (size_t i = 0; i < n; ++i) front[i] = i;
+    for (size_t obj = 0; obj < rows[0].size(); ++obj) {
+        std::sort(front.begin(), front.end(),
+                  [&rows, obj](size_t a, size_t b) { return rows[a][obj] < rows[b][obj]; });
+        distances[front[0]] = INFINITE;
+        distances[front[n - 1]] = INFINITE;
+
+        const double range = rows[front[n - 1]][obj] - rows[front[0]][obj];
+        if (std::fabs(range) < 1e-10) continue;
+        for (size_t i = 1; i < n - 1; ++i) {
+            distances[front[i]] += (rows[front[i + 1]][obj] - rows[front[i - 1]][obj]) / range;
+        }
+    }
+    return distances;
+}
+
+// Distinct values in every objective, so both orders are unique
+Rows randomRows(std::mt19937& rng, size_t n, size_t m) {
+    std::uniform_real_distribution<double> value(-50.0, 50.0);
+    Rows rows(n, std::vector<double>(m));
+    for (auto& row : rows) {
+        for (double& v : row) v = value(rng);
+    }
+    return rows;
+}
+
+void testMatchesFormer() {
+    std::mt19937 rng(17);
+    CrowdingDistance crowding;  // Reused, as NSGA2Base does
+    for (size_t round = 0; round < 200; ++round) {
+        const size_t n = 1 + round % 40;
+        const size_t m = 1 + round % 4;
+        const Rows rows = randomRows(rng, n, m);
+        const auto& distances = compute(crowding, rows);
+        const auto expected = formerCrowding(rows);
+        CHECK(distances.size() == n);
+        for (size_t i = 0; i < std::min(n, distances.size()); ++i) {
+            if (std::isinf(expected[i])) {
+                CHECK(std::isinf(distances[i]));
+            } else {
+                CHECK_NEAR(distances[i], expected[i], 1e-12);
+            }
+        }
+    }
+}
+
+// The best and worst point of every objective are infinitely far; interior
+// points add the gap between their neighbours over the objective's range
+void testByHand() {
+    CrowdingDistance crowding;
+    const Rows rows = {{0, 10}, {1, 6}, {4, 2}, {10, 0}, {2, 5}};
+    const auto& distances = compute(crowding, rows);
+    CHECK(std::isinf(distances[0]));
+    CHECK(std::isinf(distances[3]));
+    CHECK_NEAR(distances[1], (2.0 - 0.0) / 10 + (10.0 - 5.0) / 10, 1e-12);
+    CHECK_NEAR(distances[4], (4.0 - 1.0) / 10 + (6.0 - 2.0) / 10, 1e-12);
+    CHECK_NEAR(distances[2], (10.0 - 2.0) / 10 + (5.0 - 0.0) / 10, 1e-12);
+
+    // With one or two points every point is a boundary point
+    CHECK(std::isinf(compute(crowding, {{1, 2}})[0]));
+    const auto& pair = compute(crowding, {{1, 2}, {2, 1}});
+    CHECK(std::isinf(pair[0]) && std::isinf(pair[1]));
+    CHECK(compute(crowding, {}).empty());
+}
+
+// An objective whose range is below 1e-10 adds nothing to the interior points:
+// it can only mark two more points as boundary points
+void testZeroRange() {
+    std::mt19937 rng(29);
+    CrowdingDistance crowding;
+    for (size_t round = 0; round < 50; ++round) {
+        Rows rows = randomRows(rng, 3 + round % 20, 2);
+        const auto without = compute(crowding, rows);
+        for (size_t i = 0; i < rows.size(); ++i) rows[i].push_back(7.5 + (round % 2) * 1e-13 * (i % 3));
+        const auto with = compute(crowding, rows);
+
+        size_t marked = 0;
+        for (size_t i = 0; i < rows.size(); ++i) {
+            if (std::isinf(without[i])) {
+                CHECK(std::isinf(with[i]));
+            } else if (std::isinf(with[i])) {
+                ++marked;
+            } else {
+                CHECK(with[i] == without[i]);
+            }
+        }
+        CHECK(marked <= 2);
+    }
+
+    // Every objective constant: only boundary points are set, at most two per objective
+    const Rows same(6, std::vector<double>{1.0, 2.0});
+    const auto& distances = compute(crowding, same);
+    const auto boundary = std::count_if(distances.begin(), distances.end(), [](double d) { return std::isinf(d); });
+    CHECK(boundary >= 2 && boundary <= 4);
+    CHECK(std::count(distances.begin(), distances.end(), 0.0) == 6 - boundary);
+}
+
+} // namespace
+
+int main() {
+    testMatchesFormer();
+    testByHand();
+    testZeroRange();
+    return test::testResult();
+}
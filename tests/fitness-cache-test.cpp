@@ -0,0 +1,131 @@
+// File: tests/fitness-cache-test.cpp
+// Fitness memoization: hits need the full key, a full probe window evicts the
+// slot at the hash position, and the statistics count every case
+
+#include "fitness-cache.hpp"
+#include "test-support.hpp"
+#include <random>
+#include <unordered_map>
+
+using namespace tourist;
+
+namespace {
+
+using Cache = FitnessCache<int, double>;
+
+constexpr size_t PROBES = 8;  // FitnessCache::MAX_PROBES
+
+void testCapacity() {
+    CHECK(!Cache(0).enabled());
+    CHECK(Cache(1).capacity() == 1);
+    CHECK(Cache(5).capacity() == 8);
+    CHECK(Cache(64).capacity() == 64);
+}
+
+void testHitsAndCollisions() {
+    Cache cache(16);
+    CHECK(cache.find(3, 30) == nullptr);
+    cache.insert(3, 30, 1.5);
+
+    const double* value = cache.find(3, 30);
+    CHECK(value != nullptr && *value == 1.5);
+
+    // Same hash, different key: never answered with another key's value
+    CHECK(cache.find(3, 31) == nullptr);
+    cache.insert(3, 31, 2.5);
+    value = cache.find(3, 31);
+    CHECK(value != nullptr && *value == 2.5);
+
+    // Storing a key again replaces its value without evicting anything
+    cache.insert(3, 30, 4.0);
+    value = cache.find(3, 30);
+    CHECK(value != nullptr && *value == 4.0);
+
+    const auto& stats = cache.stats();
+    CHECK(stats.lookups == 5);
+    CHECK(stats.hits == 3);
+    CHECK(stats.insertions == 3);
+    CHECK(stats.evictions == 0);
+    CHECK_NEAR(stats.hitRate(), 0.6, 1e-12);
+}
+
+// Keys sharing a hash fill consecutive slots; once PROBES of them are stored,
+// the next one takes the slot at the hash position
+void testEviction() {
+    Cache cache(64);
+    const std::uint64_t hash = 62;  // The probe window wraps around the table
+    for (int key = 0; key < static_cast<int>(PROBES); ++key) {
+        cache.insert(hash, key, key * 10.0);
+    }
+    CHECK(cache.stats().evictions == 0);
+    for (int key = 0; key < static_cast<int>(PROBES); ++key) {
+        const double* value = cache.find(hash, key);
+        CHECK(value != nullptr && *value == key * 10.0);
+    }
+
+    cache.insert(hash, 100, 1000.0);
+    CHECK(cache.stats().evictions == 1);
+    CHECK(cache.find(hash, 0) == nullptr);
+    const double* value = cache.find(hash, 100);
+    CHECK(value != nullptr && *value == 1000.0);
+    for (int key = 1; key < static_cast<int>(PROBES); ++key) {
+        CHECK(cache.find(hash, key) != nullptr);
+    }
+
+    // The window of the next hash still reaches a free slot; once it is taken,
+    // that hash evicts its own home slot
+    cache.insert(hash + 1, 200, 2000.0);
+    CHECK(cache.stats().evictions == 1);
+    cache.insert(hash + 1, 201, 2010.0);
+    CHECK(cache.stats().evictions == 2);
+    CHECK(cache.find(hash, 1) == nullptr);
+    CHECK(cache.find(hash + 1, 200) != nullptr);
+    CHECK(cache.find(hash + 1, 201) != nullptr);
+    CHECK(cache.stats().insertions == PROBES + 3);
+
+    cache.clear();
+    CHECK(cache.find(hash, 100) == nullptr);
+    CHECK(cache.stats().lookups == 1);
+    CHECK(cache.stats().hits == 0);
+    CHECK(cache.stats().evictions == 0);
+}
+
+// Random traffic against a model of the table: a lookup may miss a stored key
+// only after it was evicted, and never returns a stale or foreign value
+void testRandomTraffic() {
+    std::mt19937 rng(13);
+    std::uniform_int_distribution<int> key_dist(0, 300);
+    Cache cache(32);
+    std::unordered_map<int, double> stored;
+    size_t lookups = 0;
+    size_t hits = 0;
+    for (size_t step = 0; step < 20000; ++step) {
+        const int key = key_dist(rng);
+        const std::uint64_t hash = static_cast<std::uint64_t>(key) % 40;  // Many shared hashes
+        ++lookups;
+        if (const double* value = cache.find(hash, key)) {
+            ++hits;
+            CHECK(stored.count(key) == 1 && *value == stored[key]);
+        } else {
+            const double fitness = static_cast<double>(step);
+            cache.insert(hash, key, fitness);
+            stored[key] = fitness;
+        }
+    }
+    const auto& stats = cache.stats();
+    CHECK(stats.lookups == lookups);
+    CHECK(stats.hits == hits);
+    CHECK(stats.insertions == lookups - hits);
+    CHECK(stats.evictions > 0);
+    CHECK(stats.evictions <= stats.insertions);
+}
+
+} // namespace
+
+int main() {
+    testCapacity();
+    testHitsAndCollisions();
+    testEviction();
+    testRandomTraffic();
+    return test::testResult();
+}
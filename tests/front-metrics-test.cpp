@@ -0,0 +1,75 @@
+// File: tests/front-metrics-test.cpp
+// Hypervolumes reported by tourist_metrics: the self-check cases of the former
+// metrics/calculate_hypervolume.py and the raw hypervolume of the NSGA-II
+// results in results/, checked against a brute-force grid count
+
+#include "front-metrics.hpp"
+#include "hypervolume.hpp"
+#include "brute-force-hypervolume.hpp"
+#include "test-support.hpp"
+#include <string>
+#include <vector>
+
+using namespace tourist;
+using utils::FrontMetrics;
+using utils::HypervolumeCalculator;
+using test::bruteForceHypervolume;
+
+namespace {
+
+using Points = std::vector<std::vector<double>>;
+
+constexpr double TOLERANCE = 1e-9;
+
+const std::string SOURCE_DIR = TOURIST_SOURCE_DIR;
+
+Points rows(const std::vector<double>& values, size_t d) {
+    Points points;
+    for (size_t i = 0; i < values.size(); i += d) {
+        points.emplace_back(values.begin() + i, values.begin() + i + d);
+    }
+    return points;
+}
+
+// Expected volume: (250-100)*(250-200) + (250-150)*(200-150) + (250-200)*(150-100)
+void testPython2D() {
+    const Points points = {{100, 200}, {150, 150}, {200, 100}};
+    const std::vector<double> reference = {250, 250};
+    CHECK_NEAR(HypervolumeCalculator::calculate(points, reference, 0), 15000.0, TOLERANCE);
+    CHECK_NEAR(bruteForceHypervolume(points, reference, 0), 15000.0, TOLERANCE);
+}
+
+// Objectives stored as the results files are read: [cost, time, -attractions, -neighborhoods]
+void testPython4D() {
+    const Points points = {{100, 200, -8, -7}, {150, 150, -7, -8}, {200, 100, -9, -6}};
+    const std::vector<double> reference = {250, 250, -5, -5};
+    const double expected = bruteForceHypervolume(points, reference, 0);
+    CHECK(expected > 0.0);
+    CHECK_NEAR(HypervolumeCalculator::calculate(points, reference, 0), expected, TOLERANCE);
+}
+
+// Guards the raw hypervolume reported in metrics.csv for the committed NSGA-II results
+void testResultsFile() {
+    const auto front = FrontMetrics::load(SOURCE_DIR + "/results/nsga2-resultados.csv");
+    CHECK(front.solutions == 74);
+    CHECK(front.size() > 0);
+    
+    const std::vector<double> reference(FrontMetrics::REFERENCE_POINT.begin(), FrontMetrics::REFERENCE_POINT.end());
+    const double expected = bruteForceHypervolume(rows(front.values, 4), reference, 0);
+    CHECK_NEAR(expected, 9252317.724, TOLERANCE);
+    
+    const auto volumes = FrontMetrics::hypervolumes({front}, front.values, 2);
+    CHECK(volumes.size() == 1);
+    CHECK_NEAR(volumes[0].raw, expected, TOLERANCE);
+    CHECK_NEAR(volumes[0].ratio, 1.0, TOLERANCE);
+    CHECK(volumes[0].normalized > 0.0 && volumes[0].normalized < 1.0);
+}
+
+} // namespace
+
+int main() {
+    testPython2D();
+    testPython4D();
+    testResultsFile();
+    return test::testResult();
+}
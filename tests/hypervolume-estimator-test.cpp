@@ -0,0 +1,56 @@
+// File: tests/hypervolume-estimator-test.cpp
+// The Monte Carlo estimate does not depend on the thread count and its
+// interval covers the exact hypervolume
+
+#include "hypervolume-estimator.hpp"
+#include "test-support.hpp"
+#include <random>
+#include <vector>
+
+using namespace tourist;
+using utils::HypervolumeCalculator;
+using utils::HypervolumeEstimator;
+
+int main() {
+    // Mutually non-dominated points on the simplex, attractions maximized as in the optimizer
+    const size_t d = 4;
+    const unsigned mask = HypervolumeCalculator::DEFAULT_MAXIMIZE_MASK;
+    std::mt19937 rng(7);
+    std::exponential_distribution<double> value(1.0);
+    std::vector<std::vector<double>> points(300, std::vector<double>(d));
+    for (auto& point : points) {
+        double sum = 0.0;
+        for (auto& x : point) sum += (x = value(rng));
+        for (auto& x : point) x /= sum;
+        point[2] = -point[2];
+    }
+    const std::vector<double> reference = {1.0, 1.0, -1.0, 1.0};
+    const double exact = HypervolumeCalculator::calculate(points, reference, mask);
+    
+    HypervolumeEstimator::Options options;
+    options.max_samples = 1u << 18;
+    options.confidence = 0.999;
+    options.threads = 1;
+    const auto serial = HypervolumeEstimator(options).estimate(points, reference, mask);
+    CHECK(serial.samples == options.max_samples);
+    CHECK(serial.lower <= exact && exact <= serial.upper);
+    
+    for (size_t threads : {2, 3, 8}) {
+        options.threads = threads;
+        const auto parallel = HypervolumeEstimator(options).estimate(points, reference, mask);
+        CHECK(parallel.hits == serial.hits);
+        CHECK(parallel.samples == serial.samples);
+        CHECK(parallel.value == serial.value);
+    }
+    
+    // The precision target stops at the same batch for any thread count
+    options.target_relative_error = 0.01;
+    options.threads = 1;
+    const auto targeted = HypervolumeEstimator(options).estimate(points, reference, mask);
+    CHECK(targeted.relativeError() <= 0.01);
+    CHECK(targeted.samples < options.max_samples);
+    options.threads = 5;
+    CHECK(HypervolumeEstimator(options).estimate(points, reference, mask).samples == targeted.samples);
+    
+    return test::testResult();
+}
@@ -0,0 +1,165 @@
+// File: tests/hypervolume-survival-test.cpp
+// The SMS-EMOA truncation removes members in the order a full recount of the
+// exclusive contributions gives after every removal
+
+#include "nsga2-base.hpp"
+#include "hypervolume.hpp"
+#include "problem-data.hpp"
+#include "test-support.hpp"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace tourist {
+
+struct NSGA2BaseTestAccess {
+    using Individual = NSGA2Base::Individual;
+    using Front = NSGA2Base::Front;
+
+    static Front makeFront(const std::vector<Individual::Objectives>& points) {
+        Front front;
+        for (const auto& objectives : points) {
+            auto ind = std::make_shared<Individual>(Individual::Chromosome());
+            ind->objectives_ = objectives;
+            front.push_back(std::move(ind));
+        }
+        return front;
+    }
+
+    static Front truncate(const NSGA2Base& nsga2, Front& front, size_t keep) {
+        return nsga2.truncateByHypervolume(front, keep);
+    }
+};
+
+} // namespace tourist
+
+using namespace tourist;
+
+namespace {
+
+using Access = NSGA2BaseTestAccess;
+using Objectives = Access::Individual::Objectives;
+constexpr size_t M = Access::Individual::NUM_OBJECTIVES;
+
+// Exclusive contributions of the whole front, recounted from scratch
+std::vector<double> naiveContributions(const Access::Front& front, const std::vector<double>& reference) {
+    std::vector<double> values;
+    for (const auto& ind : front) {
+        values.insert(values.end(), ind->getObjectives().begin(), ind->getObjectives().end());
+    }
+    std::vector<double> contributions(front.size());
+    utils::HypervolumeCalculator::contributions(values.data(), front.size(), M, reference.data(),
+                                                contributions.data(), 0);
+    return contributions;
+}
+
+// Replays the truncation with a full recount before each removal. With exact
+// volumes the replay must pick the same member, ties included, as long as it
+// keeps the members in the same slots; otherwise the removed member must have
+// the smallest contribution up to rounding.
+void checkTruncation(const NSGA2Base& nsga2, const std::vector<Objectives>& points, size_t keep, bool exact) {
+    auto front = Access::makeFront(points);
+    Access::Front replay = front;
+
+    std::vector<double> reference(M, std::numeric_limits<double>::lowest());
+    for (const auto& objectives : points) {
+        for (size_t i = 0; i < M; ++i) reference[i] = std::max(reference[i], objectives[i]);
+    }
+    for (double& value : reference) value += 1.0;
+
+    const auto removed = Access::truncate(nsga2, front, keep);
+    CHECK(removed.size() == points.size() - std::min(keep, points.size()));
+    CHECK(front.size() == std::min(keep, points.size()));
+
+    for (const auto& gone : removed) {
+        const auto contributions = naiveContributions(replay, reference);
+        const size_t worst = std::min_element(contributions.begin(), contributions.end()) - contributions.begin();
+        if (exact) {
+            CHECK(gone == replay[worst]);
+        }
+        const size_t slot = std::find(replay.begin(), replay.end(), gone) - replay.begin();
+        CHECK(slot < replay.size());
+        if (slot == replay.size()) return;
+        CHECK_NEAR(contributions[slot], contributions[worst], 1e-9 * (1.0 + contributions[worst]));
+
+        replay[slot] = std::move(replay.back());
+        replay.pop_back();
+    }
+
+    // The survivors are the members the replay kept
+    auto kept = front;
+    std::sort(kept.begin(), kept.end());
+    std::sort(replay.begin(), replay.end());
+    CHECK(kept == replay);
+}
+
+// Integer points on a plane of the objective space, so members are mutually
+// non-dominated and all volumes are exact; repeats are common
+std::vector<Objectives> integerFront(std::mt19937& rng, size_t n, int sum) {
+    std::uniform_int_distribution<int> part(0, sum);
+    std::vector<Objectives> points;
+    while (points.size() < n) {
+        Objectives objectives;
+        int left = sum;
+        for (size_t i = 0; i + 1 < M; ++i) {
+            const int value = std::min(left, part(rng) / 2);
+            objectives[i] = value;
+            left -= value;
+        }
+        objectives[M - 1] = left;
+        points.push_back(objectives);
+        if (part(rng) < sum / 5) points.push_back(objectives);
+    }
+    points.resize(n);
+    return points;
+}
+
+// Real-valued points on the same kind of plane
+std::vector<Objectives> realFront(std::mt19937& rng, size_t n) {
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::vector<Objectives> points(n);
+    for (auto& objectives : points) {
+        double total = 0.0;
+        for (double& value : objectives) total += value = unit(rng);
+        for (double& value : objectives) value /= total;
+    }
+    return points;
+}
+
+NSGA2Base::Parameters testParameters() {
+    NSGA2Base::Parameters params(20, 1, 0.9, 0.1);
+    params.survival = NSGA2Base::Parameters::Survival::HYPERVOLUME;
+    params.telemetry_level = TelemetryLevel::OFF;
+    params.generations_file.clear();
+    params.profile_phases = false;
+    return params;
+}
+
+} // namespace
+
+int main() {
+    const auto attractions = test::loadProblemData();
+    CHECK(!attractions.empty());
+    if (attractions.empty()) return test::testResult();
+    NSGA2Base nsga2(attractions, testParameters());
+
+    std::mt19937 rng(7);
+    for (size_t round = 0; round < 40; ++round) {
+        const size_t n = 2 + round % 19;
+        std::uniform_int_distribution<size_t> keep(0, n);
+        checkTruncation(nsga2, integerFront(rng, n, 6 + static_cast<int>(round % 5) * 3), keep(rng), true);
+        checkTruncation(nsga2, integerFront(rng, n, 8), 1, true);
+        checkTruncation(nsga2, realFront(rng, n), keep(rng), false);
+    }
+
+    // Nothing to remove
+    auto points = integerFront(rng, 5, 10);
+    auto front = Access::makeFront(points);
+    CHECK(Access::truncate(nsga2, front, 5).empty());
+    CHECK(Access::truncate(nsga2, front, 9).empty());
+    CHECK(front.size() == 5);
+
+    return test::testResult();
+}
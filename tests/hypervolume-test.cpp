@@ -0,0 +1,197 @@
+// File: tests/hypervolume-test.cpp
+// Exact hypervolume, exclusive contributions, the incremental tracker and the
+// parallel calculation, checked against a brute-force grid count
+
+#include "hypervolume.hpp"
+#include "hypervolume-tracker.hpp"
+#include "brute-force-hypervolume.hpp"
+#include "test-support.hpp"
+#include <random>
+#include <vector>
+
+using namespace tourist;
+using utils::HypervolumeCalculator;
+using utils::HypervolumeTracker;
+using test::bruteForceHypervolume;
+
+namespace {
+
+using Points = std::vector<std::vector<double>>;
+
+constexpr double TOLERANCE = 1e-9;
+
+std::mt19937 rng(20240611);
+
+// Integer coordinates in [0, 10] produce ties and duplicates; the reference sits
+// at 8 for minimized objectives and 2 for maximized ones, so some points do not
+// dominate it
+Points integerPoints(size_t count, size_t d) {
+    std::uniform_int_distribution<int> value(0, 10);
+    Points points(count, std::vector<double>(d));
+    for (auto& point : points) {
+        for (auto& x : point) x = value(rng);
+    }
+    return points;
+}
+
+Points realPoints(size_t count, size_t d) {
+    std::uniform_real_distribution<double> value(0.0, 10.0);
+    Points points(count, std::vector<double>(d));
+    for (auto& point : points) {
+        for (auto& x : point) x = value(rng);
+    }
+    return points;
+}
+
+// Mutually non-dominated points on the simplex x_1 + ... + x_d = 1 (all minimized)
+Points simplexPoints(size_t count, size_t d) {
+    std::exponential_distribution<double> value(1.0);
+    Points points(count, std::vector<double>(d));
+    for (auto& point : points) {
+        double sum = 0.0;
+        for (auto& x : point) sum += (x = value(rng));
+        for (auto& x : point) x /= sum;
+    }
+    return points;
+}
+
+std::vector<double> referencePoint(size_t d, unsigned mask) {
+    std::vector<double> reference(d);
+    for (size_t i = 0; i < d; ++i) reference[i] = (mask >> i & 1u) ? 2.0 : 8.0;
+    return reference;
+}
+
+std::vector<double> flatten(const Points& points) {
+    std::vector<double> values;
+    for (const auto& point : points) values.insert(values.end(), point.begin(), point.end());
+    return values;
+}
+
+Points without(const Points& points, size_t index) {
+    Points rest = points;
+    rest.erase(rest.begin() + static_cast<std::ptrdiff_t>(index));
+    return rest;
+}
+
+// Largest set sizes for which the brute force stays quick, by dimension
+size_t bruteForceSize(size_t d) {
+    static const size_t sizes[] = {0, 0, 60, 30, 14, 9, 6};
+    return sizes[d];
+}
+
+void testCalculate() {
+    for (size_t d = 2; d <= 6; ++d) {
+        for (unsigned mask = 0; mask < (1u << d); ++mask) {
+            const auto reference = referencePoint(d, mask);
+            for (int trial = 0; trial < 3; ++trial) {
+                const auto points = trial == 2 ? realPoints(bruteForceSize(d), d)
+                                               : integerPoints(bruteForceSize(d), d);
+                const double expected = bruteForceHypervolume(points, reference, mask);
+                CHECK_NEAR(HypervolumeCalculator::calculate(points, reference, mask), expected, TOLERANCE);
+                
+                const auto values = flatten(points);
+                CHECK_NEAR(HypervolumeCalculator::calculate(values.data(), points.size(), d, reference.data(), mask),
+                           expected, TOLERANCE);
+            }
+        }
+    }
+    
+    // Degenerate inputs
+    CHECK(HypervolumeCalculator::calculate(Points{}, {1.0, 1.0}, 0) == 0.0);
+    CHECK(HypervolumeCalculator::calculate(Points{{2.0, 0.0}, {0.0, 1.0}}, {1.0, 1.0}, 0) == 0.0);
+    CHECK_NEAR(HypervolumeCalculator::calculate(Points{{0.5, 0.5}, {0.5, 0.5}}, {1.0, 1.0}, 0), 0.25, TOLERANCE);
+}
+
+void testContributions() {
+    for (size_t d = 2; d <= 5; ++d) {
+        for (unsigned mask = 0; mask < (1u << d); ++mask) {
+            const auto reference = referencePoint(d, mask);
+            const auto points = integerPoints(bruteForceSize(d), d);
+            const double total = bruteForceHypervolume(points, reference, mask);
+            const auto contributions = HypervolumeCalculator::contributions(points, reference, mask);
+            CHECK(contributions.size() == points.size());
+            
+            const auto values = flatten(points);
+            for (size_t p = 0; p < points.size(); ++p) {
+                const auto rest = without(points, p);
+                const double expected = total - bruteForceHypervolume(rest, reference, mask);
+                CHECK_NEAR(contributions[p], expected, TOLERANCE);
+                
+                const auto others = flatten(rest);
+                CHECK_NEAR(HypervolumeCalculator::contribution(values.data() + p * d, others.data(), rest.size(),
+                                                               d, reference.data(), mask),
+                           expected, TOLERANCE);
+            }
+        }
+    }
+}
+
+// After every update the tracked volume matches a full calculation of the current set
+void testTracker() {
+    const size_t d = 4;
+    const unsigned mask = HypervolumeCalculator::DEFAULT_MAXIMIZE_MASK;
+    const auto reference = referencePoint(d, mask);
+    HypervolumeTracker tracker(reference, mask);
+    
+    const auto candidates = realPoints(40, d);
+    std::vector<bool> tracked(candidates.size(), false);
+    std::uniform_int_distribution<size_t> pick(0, candidates.size() - 1);
+    for (int step = 0; step < 300; ++step) {
+        const size_t id = pick(rng);
+        if (tracked[id]) {
+            tracker.remove(id);
+        } else {
+            tracker.insert(id, candidates[id].data());
+        }
+        tracked[id] = !tracked[id];
+        
+        Points current;
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            if (tracked[i]) current.push_back(candidates[i]);
+        }
+        CHECK(tracker.size() == current.size());
+        const double expected = HypervolumeCalculator::calculate(current, reference, mask);
+        CHECK_NEAR(tracker.volume(), expected, TOLERANCE);
+    }
+    
+    Points current;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (tracked[i]) current.push_back(candidates[i]);
+    }
+    CHECK(tracker.refresh() == HypervolumeCalculator::calculate(current, reference, mask));
+    CHECK(tracker.remove(candidates.size()) == 0.0);
+    
+    tracker.clear();
+    CHECK(tracker.size() == 0);
+    CHECK(tracker.volume() == 0.0);
+    tracker.insert(7, candidates[7].data());
+    CHECK_THROWS(tracker.insert(7, candidates[7].data()));
+}
+
+// The parallel calculation adds the slice volumes in the serial order
+void testParallel() {
+    for (size_t d = 4; d <= 5; ++d) {
+        const size_t count = d == 4 ? 600 : 300;
+        const auto values = flatten(simplexPoints(count, d));
+        for (unsigned mask : {0u, 1u << 2}) {
+            std::vector<double> reference(d);
+            for (size_t i = 0; i < d; ++i) reference[i] = (mask >> i & 1u) ? 0.0 : 1.0;
+            const double serial = HypervolumeCalculator::calculate(values.data(), count, d, reference.data(), mask);
+            CHECK(serial > 0.0);
+            for (size_t threads : {1, 2, 3, 8}) {
+                CHECK(HypervolumeCalculator::calculateParallel(values.data(), count, d, reference.data(), mask,
+                                                               threads) == serial);
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    testCalculate();
+    testContributions();
+    testTracker();
+    testParallel();
+    return test::testResult();
+}
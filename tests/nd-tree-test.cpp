@@ -0,0 +1,121 @@
+// File: tests/nd-tree-test.cpp
+// The ND-tree archive against a brute-force list of non-dominated points
+
+#include "nd-tree.hpp"
+#include "test-support.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace tourist;
+
+namespace {
+
+constexpr size_t DIM = 3;
+using Tree = NDTree<int, DIM>;
+using Point = Tree::Point;
+
+struct Archived {
+    Point point;
+    int id;
+};
+
+bool weaklyDominates(const Point& a, const Point& b) {
+    for (size_t i = 0; i < DIM; ++i) {
+        if (a[i] > b[i]) return false;
+    }
+    return true;
+}
+
+bool sameEntries(std::vector<Archived> a, std::vector<Archived> b) {
+    auto byId = [](const Archived& x, const Archived& y) { return x.id < y.id; };
+    std::sort(a.begin(), a.end(), byId);
+    std::sort(b.begin(), b.end(), byId);
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].id != b[i].id || a[i].point != b[i].point) return false;
+    }
+    return true;
+}
+
+std::vector<Archived> treeEntries(const Tree& tree) {
+    std::vector<Archived> entries;
+    tree.forEach([&entries](const Tree::Entry& entry) { entries.push_back({entry.point, entry.payload}); });
+    return entries;
+}
+
+// Points near the plane x + y + z = spread are mostly mutually non-dominated and
+// fill the leaves; now and then a point close to the origin removes whole subtrees
+Point randomPoint(std::mt19937& rng, int spread) {
+    std::uniform_int_distribution<int> coordinate(0, spread);
+    std::uniform_int_distribution<int> kind(0, 19);
+    Point point;
+    if (kind(rng) == 0) {
+        std::uniform_int_distribution<int> small(0, spread / 4);
+        for (auto& x : point) x = small(rng);
+        return point;
+    }
+    const int a = coordinate(rng);
+    const int b = coordinate(rng);
+    const int lo = std::min(a, b);
+    const int hi = std::max(a, b);
+    point = {double(lo), double(hi - lo), double(spread - hi)};
+    std::uniform_int_distribution<int> noise(0, 2);
+    for (auto& x : point) x += noise(rng);
+    return point;
+}
+
+void runSequence(std::uint32_t seed, size_t max_leaf_size, int spread, size_t inserts) {
+    std::mt19937 rng(seed);
+    Tree tree(max_leaf_size);
+    std::vector<Archived> expected;
+    
+    for (size_t step = 0; step < inserts; ++step) {
+        const Point point = randomPoint(rng, spread);
+        const int id = static_cast<int>(step);
+        
+        // Brute force: rejected if weakly dominated, otherwise the points it dominates leave
+        const bool covered = std::any_of(expected.begin(), expected.end(),
+                                         [&point](const Archived& a) { return weaklyDominates(a.point, point); });
+        CHECK(tree.isCovered(point) == covered);
+        std::vector<Archived> removed_expected;
+        if (!covered) {
+            auto keep = std::stable_partition(expected.begin(), expected.end(),
+                                              [&point](const Archived& a) { return !weaklyDominates(point, a.point); });
+            removed_expected.assign(keep, expected.end());
+            expected.erase(keep, expected.end());
+            expected.push_back({point, id});
+        }
+        
+        std::vector<Archived> removed;
+        const bool inserted = tree.insert(point, id, [&removed](const Tree::Entry& entry) {
+            removed.push_back({entry.point, entry.payload});
+        });
+        CHECK(inserted == !covered);
+        CHECK(sameEntries(removed, removed_expected));
+        CHECK(tree.size() == expected.size());
+        CHECK(sameEntries(treeEntries(tree), expected));
+        
+        // Every archived point and the just rejected one are covered; a point
+        // strictly better than everything is not
+        CHECK(tree.isCovered(point));
+        const Point below = {-1.0, -1.0, -1.0};
+        CHECK(!tree.isCovered(below));
+    }
+    
+    tree.clear();
+    CHECK(tree.empty());
+    CHECK(!tree.isCovered(Point{0.0, 0.0, 0.0}));
+}
+
+} // namespace
+
+int main() {
+    CHECK_THROWS(Tree(DIM));
+    
+    for (std::uint32_t seed = 1; seed <= 20; ++seed) {
+        runSequence(seed, Tree::NUM_CHILDREN, 12, 400);   // Small leaves, many duplicates
+        runSequence(seed + 100, 6, 40, 600);
+    }
+    return test::testResult();
+}
@@ -0,0 +1,166 @@
+// File: tests/nsga2-fronts-test.cpp
+// The non-domination levels kept by the steady-state update (ENLU) must equal a
+// full fast non-dominated sort of the population after every insertion and removal
+
+#include "nsga2-base.hpp"
+#include "problem-data.hpp"
+#include "test-support.hpp"
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace tourist {
+
+struct NSGA2BaseTestAccess {
+    using Individual = NSGA2Base::Individual;
+    using IndividualPtr = NSGA2Base::IndividualPtr;
+    using Front = NSGA2Base::Front;
+
+    // How the next insertion will update the levels
+    struct Branches {
+        size_t shift{0};        // The whole landing level is dominated and moves down
+        size_t cascade{0};      // Part of the landing level is demoted to the next one
+    };
+
+    // The levels must match a full sort, and every rank its level
+    static void checkLevels(NSGA2Base& nsga2) {
+        size_t members = 0;
+        for (size_t level = 0; level < nsga2.fronts_.size(); ++level) {
+            CHECK(!nsga2.fronts_[level].empty());
+            for (const auto& ind : nsga2.fronts_[level]) {
+                CHECK(ind->getRank() == static_cast<int>(level));
+            }
+            members += nsga2.fronts_[level].size();
+        }
+        CHECK(members == nsga2.population_.size());
+        CHECK(nsga2.crowding_valid_.size() == nsga2.fronts_.size());
+
+        // Sorting assigns ranks again, so it runs after the rank check
+        const auto expected = nsga2.fastNonDominatedSort(nsga2.population_);
+        CHECK(expected.size() == nsga2.fronts_.size());
+        for (size_t level = 0; level < std::min(expected.size(), nsga2.fronts_.size()); ++level) {
+            Front actual_level = nsga2.fronts_[level];
+            Front expected_level = expected[level];
+            std::sort(actual_level.begin(), actual_level.end());
+            std::sort(expected_level.begin(), expected_level.end());
+            CHECK(actual_level == expected_level);
+        }
+    }
+
+    static void classify(const NSGA2Base& nsga2, const Individual& ind, Branches& branches) {
+        const auto& fronts = nsga2.fronts_;
+        size_t level = 0;
+        while (level < fronts.size() &&
+               std::any_of(fronts[level].begin(), fronts[level].end(),
+                           [&ind](const IndividualPtr& member) { return member->dominates(ind); })) {
+            ++level;
+        }
+        if (level == fronts.size()) return;
+
+        const auto dominated = std::count_if(fronts[level].begin(), fronts[level].end(),
+            [&ind](const IndividualPtr& member) { return ind.dominates(*member); });
+        if (dominated == static_cast<long>(fronts[level].size())) {
+            ++branches.shift;
+        } else if (dominated > 0) {
+            ++branches.cascade;
+        }
+    }
+
+    static void insert(NSGA2Base& nsga2, const IndividualPtr& ind, Branches& branches) {
+        classify(nsga2, *ind, branches);
+        nsga2.insertIntoFronts(ind);
+        nsga2.population_.push_back(ind);
+        checkLevels(nsga2);
+    }
+
+    static void removeWorst(NSGA2Base& nsga2) {
+        nsga2.removeWorstFromFronts();
+        checkLevels(nsga2);
+    }
+
+    // Individuals with small integer objectives, so that dominance, ties and
+    // duplicates are all common; every 16th one dominates the whole population
+    static void runSynthetic(NSGA2Base& nsga2, std::mt19937& rng, size_t steps, Branches& branches) {
+        std::uniform_int_distribution<int> value(0, 4);
+        std::uniform_int_distribution<size_t> removals(0, 2);
+        double best = 0.0;
+
+        for (size_t step = 0; step < steps; ++step) {
+            auto ind = std::make_shared<Individual>(Individual::Chromosome());
+            if (step % 16 == 15) {
+                best -= 1.0;
+                ind->objectives_.fill(best);
+            } else {
+                for (double& objective : ind->objectives_) objective = value(rng);
+            }
+            insert(nsga2, ind, branches);
+
+            const size_t target = 30;
+            size_t remove = nsga2.population_.size() > target ? nsga2.population_.size() - target : 0;
+            if (remove == 0 && !nsga2.population_.empty() && step % 5 == 0) remove = removals(rng);
+            for (size_t k = 0; k < remove && !nsga2.population_.empty(); ++k) {
+                removeWorst(nsga2);
+            }
+        }
+    }
+
+    // The steps of steadyStateGeneration(), checked after each insertion and removal
+    static void runSteadyState(NSGA2Base& nsga2, size_t steps, Branches& branches) {
+        nsga2.initializePopulation();
+        nsga2.fronts_ = nsga2.fastNonDominatedSort(nsga2.population_);
+        nsga2.crowding_valid_.assign(nsga2.fronts_.size(), false);
+        checkLevels(nsga2);
+
+        for (size_t step = 0; step < steps; ++step) {
+            const auto offspring = nsga2.createOffspring(nsga2.population_, nsga2.params_.offspring_per_step);
+            for (const auto& child : offspring) insert(nsga2, child, branches);
+            for (size_t k = 0; k < offspring.size(); ++k) removeWorst(nsga2);
+        }
+    }
+};
+
+} // namespace tourist
+
+using namespace tourist;
+
+namespace {
+
+NSGA2Base::Parameters testParameters(NSGA2Base::Parameters::Survival survival) {
+    NSGA2Base::Parameters params(20, 1, 0.9, 0.3);
+    params.mode = NSGA2Base::Parameters::Mode::STEADY_STATE;
+    params.offspring_per_step = 2;
+    params.survival = survival;
+    params.telemetry_level = TelemetryLevel::OFF;
+    params.generations_file.clear();
+    params.profile_phases = false;
+    params.track_hypervolume = false;
+    return params;
+}
+
+} // namespace
+
+int main() {
+    const auto attractions = test::loadProblemData();
+    CHECK(!attractions.empty());
+    if (attractions.empty()) return test::testResult();
+
+    for (auto survival : {NSGA2Base::Parameters::Survival::CROWDING,
+                          NSGA2Base::Parameters::Survival::HYPERVOLUME}) {
+        NSGA2BaseTestAccess::Branches synthetic;
+        for (unsigned seed = 1; seed <= 5; ++seed) {
+            NSGA2Base nsga2(attractions, testParameters(survival));
+            std::mt19937 rng(seed);
+            NSGA2BaseTestAccess::runSynthetic(nsga2, rng, 300, synthetic);
+        }
+        CHECK(synthetic.shift > 0);
+        CHECK(synthetic.cascade > 0);
+
+        NSGA2BaseTestAccess::Branches steady;
+        NSGA2Base nsga2(attractions, testParameters(survival));
+        NSGA2BaseTestAccess::runSteadyState(nsga2, 200, steady);
+        CHECK(steady.cascade > 0);
+    }
+
+    return test::testResult();
+}
@@ -0,0 +1,31 @@
+// File: tests/problem-data.hpp
+// Transport matrices and attractions of the project, loaded once per test
+
+#pragma once
+
+#include "models.hpp"
+#include "utils.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace tourist {
+namespace test {
+
+// Loads the OSRM matrices and data/attractions.txt of the source tree; returns
+// no attractions if the matrices cannot be read
+inline std::vector<Attraction> loadProblemData() {
+    const std::string source_dir = TOURIST_SOURCE_DIR;
+    const std::string osrm = source_dir + "/OSRM/";
+    if (!utils::Parser::loadTransportMatrices(osrm + "matriz_distancias_carro_metros.csv",
+                                              osrm + "matriz_distancias_pe_metros.csv",
+                                              osrm + "matriz_tempos_carro_min.csv",
+                                              osrm + "matriz_tempos_pe_min.csv")) {
+        std::cerr << "Could not load the transport matrices from " << osrm << "\n";
+        return {};
+    }
+    return utils::Parser::loadAttractions(source_dir + "/data/attractions.txt");
+}
+
+} // namespace test
+} // namespace tourist
@@ -0,0 +1,220 @@
+// File: tests/quality-indicators-test.cpp
+// The blocked indicator kernels and the reference index, checked against plain
+// loops over the points, and Deb's spread on fronts worked out by hand
+
+#include "quality-indicators.hpp"
+#include "test-support.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace tourist;
+using utils::ObjectiveSet;
+using utils::QualityIndicators;
+using utils::ReferenceIndex;
+
+namespace {
+
+using Rows = std::vector<std::vector<double>>;
+
+constexpr double TOLERANCE = 1e-12;
+constexpr double INFINITE = std::numeric_limits<double>::infinity();
+
+ObjectiveSet toSet(const Rows& rows, size_t d) {
+    ObjectiveSet set(d);
+    for (const auto& row : rows) set.add(row.data());
+    return set;
+}
+
+double squaredDistance(const std::vector<double>& a, const std::vector<double>& b) {
+    double total = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) total += (a[i] - b[i]) * (a[i] - b[i]);
+    return total;
+}
+
+// Distance from a to r counting only the objectives in which a is worse
+double shortfall(const std::vector<double>& a, const std::vector<double>& r) {
+    double total = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        const double diff = std::max(a[i] - r[i], 0.0);
+        total += diff * diff;
+    }
+    return std::sqrt(total);
+}
+
+double naiveGD(const Rows& front, const Rows& reference) {
+    double total = 0.0;
+    for (const auto& a : front) {
+        double best = INFINITE;
+        for (const auto& r : reference) best = std::min(best, squaredDistance(a, r));
+        total += std::sqrt(best);
+    }
+    return total / front.size();
+}
+
+double naiveIGDPlus(const Rows& front, const Rows& reference) {
+    double total = 0.0;
+    for (const auto& r : reference) {
+        double best = INFINITE;
+        for (const auto& a : front) best = std::min(best, shortfall(a, r));
+        total += best;
+    }
+    return total / reference.size();
+}
+
+double naiveEpsilon(const Rows& front, const Rows& reference, bool multiplicative) {
+    double worst = -INFINITE;
+    for (const auto& r : reference) {
+        double best = INFINITE;
+        for (const auto& a : front) {
+            double factor = -INFINITE;
+            for (size_t i = 0; i < a.size(); ++i) {
+                factor = std::max(factor, multiplicative ? a[i] / r[i] : a[i] - r[i]);
+            }
+            best = std::min(best, factor);
+        }
+        worst = std::max(worst, best);
+    }
+    return worst;
+}
+
+double naiveCoverage(const Rows& a, const Rows& b) {
+    size_t covered = 0;
+    for (const auto& q : b) {
+        const bool dominated = std::any_of(a.begin(), a.end(), [&q](const std::vector<double>& p) {
+            for (size_t i = 0; i < p.size(); ++i) {
+                if (p[i] > q[i]) return false;
+            }
+            return true;
+        });
+        if (dominated) ++covered;
+    }
+    return static_cast<double>(covered) / b.size();
+}
+
+// Positive values on a coarse grid, so repeats and equal distances are common
+Rows randomRows(std::mt19937& rng, size_t n, size_t d, int levels) {
+    std::uniform_int_distribution<int> step(1, levels);
+    Rows rows(n, std::vector<double>(d));
+    for (auto& row : rows) {
+        for (double& value : row) value = 0.5 * step(rng);
+    }
+    return rows;
+}
+
+void checkIndicators(const Rows& front, const Rows& reference, size_t d) {
+    const auto a = toSet(front, d);
+    const auto r = toSet(reference, d);
+    const ReferenceIndex index(r);
+
+    const double gd = naiveGD(front, reference);
+    CHECK_NEAR(QualityIndicators::generationalDistance(a, r), gd, TOLERANCE);
+    CHECK_NEAR(QualityIndicators::generationalDistance(a, index), gd, TOLERANCE);
+    CHECK_NEAR(QualityIndicators::invertedGenerationalDistance(a, r), naiveGD(reference, front), TOLERANCE);
+    CHECK_NEAR(QualityIndicators::invertedGenerationalDistancePlus(a, r), naiveIGDPlus(front, reference), TOLERANCE);
+    CHECK_NEAR(QualityIndicators::additiveEpsilon(a, r), naiveEpsilon(front, reference, false), TOLERANCE);
+    CHECK_NEAR(QualityIndicators::multiplicativeEpsilon(a, r), naiveEpsilon(front, reference, true), TOLERANCE);
+    CHECK(QualityIndicators::coverage(a, r) == naiveCoverage(front, reference));
+    CHECK(QualityIndicators::coverage(r, a) == naiveCoverage(reference, front));
+
+    const auto values = QualityIndicators::evaluate(a, r, &index);
+    CHECK_NEAR(values.gd, gd, TOLERANCE);
+    CHECK_NEAR(values.igd_plus, naiveIGDPlus(front, reference), TOLERANCE);
+    CHECK_NEAR(values.epsilon_multiplicative, naiveEpsilon(front, reference, true), TOLERANCE);
+}
+
+// The index may return any of several equally near points, but never a farther one
+void checkNearest(const Rows& reference, const Rows& queries, size_t d) {
+    const ReferenceIndex index(toSet(reference, d));
+    CHECK(index.size() == reference.size());
+    for (const auto& query : queries) {
+        double best = INFINITE;
+        for (const auto& r : reference) best = std::min(best, squaredDistance(query, r));
+
+        double distance = -1.0;
+        const size_t found = index.nearest(query.data(), &distance);
+        CHECK(found < reference.size());
+        if (found >= reference.size()) continue;
+        CHECK(squaredDistance(query, reference[found]) == best);
+        CHECK(distance == std::sqrt(best));
+    }
+}
+
+void testRandomFronts() {
+    std::mt19937 rng(11);
+    for (size_t d = 2; d <= 4; ++d) {
+        for (size_t round = 0; round < 12; ++round) {
+            const size_t n = 1 + round * 9;
+            const size_t m = 1 + round * 23;
+            checkIndicators(randomRows(rng, n, d, 8), randomRows(rng, m, d, 8), d);
+        }
+    }
+}
+
+void testNearest() {
+    std::mt19937 rng(5);
+    for (size_t d = 2; d <= 4; ++d) {
+        // Many coincident points and queries equidistant from several of them
+        const auto reference = randomRows(rng, 400, d, 5);
+        auto queries = randomRows(rng, 200, d, 12);
+        queries.insert(queries.end(), reference.begin(), reference.begin() + 50);
+        checkNearest(reference, queries, d);
+
+        // A front of one repeated point is never split
+        const Rows same(100, std::vector<double>(d, 1.5));
+        checkNearest(same, queries, d);
+
+        // Points that differ in a single objective
+        Rows line(150, std::vector<double>(d, 2.0));
+        for (size_t p = 0; p < line.size(); ++p) line[p][d - 1] = 0.5 * (p % 7);
+        checkNearest(line, queries, d);
+    }
+}
+
+// A = {(0,4), (1,2), (4,1)} against R = {(0,5), (4,0)}: the gaps are √5 and √10,
+// their mean (√5+√10)/2, and the ends lie 1 away from the extremes (0,5) and (4,0)
+void testSpreadByHand() {
+    const Rows front = {{1, 2}, {4, 1}, {0, 4}};
+    const Rows reference = {{0, 5}, {4, 0}};
+    const double s5 = std::sqrt(5.0);
+    const double s10 = std::sqrt(10.0);
+    CHECK_NEAR(QualityIndicators::spread(toSet(front, 2), toSet(reference, 2)),
+               (2.0 + (s10 - s5)) / (2.0 + s5 + s10), TOLERANCE);
+
+    // Without a reference the extremes are the ends of A itself
+    CHECK_NEAR(QualityIndicators::spread(toSet(front, 2), ObjectiveSet(2)),
+               (s10 - s5) / (s5 + s10), TOLERANCE);
+
+    // Evenly spaced and reaching the extremes
+    const Rows uniform = {{0, 2}, {1, 1}, {2, 0}};
+    CHECK_NEAR(QualityIndicators::spread(toSet(uniform, 2), toSet(uniform, 2)), 0.0, TOLERANCE);
+
+    // A single point: only the distances to the extremes count
+    CHECK_NEAR(QualityIndicators::spread(toSet({{1, 1}}, 2), toSet(uniform, 2)), 1.0, TOLERANCE);
+}
+
+void testEdgeCases() {
+    const ObjectiveSet empty(2);
+    const auto some = toSet({{1, 2}, {2, 1}}, 2);
+    CHECK(QualityIndicators::generationalDistance(empty, some) == INFINITE);
+    CHECK(QualityIndicators::invertedGenerationalDistance(some, empty) == INFINITE);
+    CHECK(QualityIndicators::additiveEpsilon(some, empty) == INFINITE);
+    CHECK(QualityIndicators::coverage(empty, some) == 0.0);
+    CHECK(QualityIndicators::spread(empty, some) == INFINITE);
+
+    CHECK_THROWS(QualityIndicators::generationalDistance(some, ObjectiveSet(3)));
+    CHECK_THROWS(QualityIndicators::multiplicativeEpsilon(toSet({{0, 1}}, 2), some));
+    CHECK(std::isnan(QualityIndicators::evaluate(toSet({{-1, 1}}, 2), some).epsilon_multiplicative));
+}
+
+} // namespace
+
+int main() {
+    testRandomFronts();
+    testNearest();
+    testSpreadByHand();
+    testEdgeCases();
+    return test::testResult();
+}
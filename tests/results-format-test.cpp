@@ -0,0 +1,138 @@
+// File: tests/results-format-test.cpp
+// Round trip of the columnar results format, its CSV conversion and rejection
+// of damaged files
+
+#include "results-format.hpp"
+#include "test-support.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace tourist;
+
+namespace {
+
+// Two routes: three stops in two neighborhoods, and a single stop
+ResultsTable sampleTable() {
+    ResultsTable table;
+    table.dictionary = {"Cristo Redentor", "Cosme Velho", "Pao de Acucar", "Urca", "Maracana"};
+    
+    table.cost = {152.5, 40.0};
+    table.time = {395.25, 120.0};
+    table.start_time = {540.0, 540.0};
+    table.end_time = {935.25, 660.0};
+    table.attractions = {3, 1};
+    table.neighborhoods = {2, 1};
+    
+    table.stop_offsets = {0, 3, 4};
+    table.stop_names = {0, 2, 2, 4};
+    table.arrival_times = {540.0, 700.5, 800.0, 540.0};
+    table.departure_times = {660.0, 760.5, 935.25, 660.0};
+    table.arrival_modes = {ResultsTable::NO_MODE, 1, 0, ResultsTable::NO_MODE};
+    
+    table.neighborhood_offsets = {0, 2, 3};
+    table.neighborhood_names = {1, 3, 1};
+    return table;
+}
+
+std::string readText(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+void writeText(const std::string& path, const std::string& text) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << text;
+}
+
+void checkSameTable(const ResultsTable& a, const ResultsTable& b) {
+    CHECK(a.dictionary == b.dictionary);
+    CHECK(a.cost == b.cost);
+    CHECK(a.time == b.time);
+    CHECK(a.start_time == b.start_time);
+    CHECK(a.end_time == b.end_time);
+    CHECK(a.attractions == b.attractions);
+    CHECK(a.neighborhoods == b.neighborhoods);
+    CHECK(a.stop_offsets == b.stop_offsets);
+    CHECK(a.stop_names == b.stop_names);
+    CHECK(a.arrival_times == b.arrival_times);
+    CHECK(a.departure_times == b.departure_times);
+    CHECK(a.arrival_modes == b.arrival_modes);
+    CHECK(a.neighborhood_offsets == b.neighborhood_offsets);
+    CHECK(a.neighborhood_names == b.neighborhood_names);
+}
+
+// write -> read -> writeCsv gives the same CSV as converting the original table
+void testRoundTrip() {
+    const auto table = sampleTable();
+    ResultsFormat::write(table, "results-roundtrip.bin");
+    const auto loaded = ResultsFormat::read("results-roundtrip.bin");
+    checkSameTable(table, loaded);
+    
+    ResultsFormat::writeCsv(table, "results-original.csv");
+    ResultsFormat::writeCsv(loaded, "results-roundtrip.csv");
+    const auto csv = readText("results-roundtrip.csv");
+    CHECK(csv == readText("results-original.csv"));
+    
+    std::istringstream lines(csv);
+    std::string header, first, second, extra;
+    std::getline(lines, header);
+    std::getline(lines, first);
+    std::getline(lines, second);
+    CHECK(header.rfind("Solucao;CustoTotal;TempoTotal;", 0) == 0);
+    CHECK(first == "1;152.50;395.25;3;2;09:00;15:35;Cosme Velho|Urca|;"
+                   "Cristo Redentor|Pao de Acucar|Pao de Acucar|;09:00|11:40|13:20|;"
+                   "11:00|12:40|15:35|;Car|Walk|");
+    CHECK(second == "2;40.00;120.00;1;1;09:00;11:00;Cosme Velho|;Maracana|;09:00|;11:00|;");
+    CHECK(!std::getline(lines, extra));
+    
+    std::remove("results-roundtrip.bin");
+    std::remove("results-original.csv");
+    std::remove("results-roundtrip.csv");
+}
+
+void testEmptyTable() {
+    ResultsTable table;
+    table.stop_offsets = {0};
+    table.neighborhood_offsets = {0};
+    ResultsFormat::write(table, "results-empty.bin");
+    const auto loaded = ResultsFormat::read("results-empty.bin");
+    CHECK(loaded.size() == 0);
+    checkSameTable(table, loaded);
+    std::remove("results-empty.bin");
+}
+
+// Every flipped byte and every truncation must be rejected, padding included
+void testCorruption() {
+    const std::string path = "results-corrupt.bin";
+    ResultsFormat::write(sampleTable(), path);
+    const auto original = readText(path);
+    CHECK(original.size() % 8 == 0);
+    
+    for (size_t i = 0; i < original.size(); ++i) {
+        auto damaged = original;
+        damaged[i] = static_cast<char>(damaged[i] ^ 0x01);
+        writeText(path, damaged);
+        CHECK_THROWS(ResultsFormat::read(path));
+    }
+    
+    for (size_t size = 0; size < original.size(); ++size) {
+        writeText(path, original.substr(0, size));
+        CHECK_THROWS(ResultsFormat::read(path));
+    }
+    
+    CHECK_THROWS(ResultsFormat::read("results-that-do-not-exist.bin"));
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+int main() {
+    testRoundTrip();
+    testEmptyTable();
+    testCorruption();
+    return test::testResult();
+}
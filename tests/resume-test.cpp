@@ -0,0 +1,110 @@
+// File: tests/resume-test.cpp
+// A run resumed from a checkpoint continues the generation count, the evaluation
+// count and the random engine of the interrupted run
+
+#include "nsga2-base.hpp"
+#include "problem-data.hpp"
+#include "test-support.hpp"
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace tourist;
+
+namespace {
+
+NSGA2Base::Parameters testParameters(const std::string& checkpoint_file, size_t generations) {
+    NSGA2Base::Parameters params(20, generations, 0.9, 0.1);
+    params.telemetry_level = TelemetryLevel::OFF;
+    params.generations_file.clear();
+    params.profile_phases = false;
+    params.checkpoint_file = checkpoint_file;
+    params.checkpoint_interval = 2;
+    params.resume = true;
+    return params;
+}
+
+void copyFile(const std::string& from, const std::string& to) {
+    std::ifstream in(from, std::ios::binary);
+    std::ofstream out(to, std::ios::binary | std::ios::trunc);
+    out << in.rdbuf();
+}
+
+CheckpointData readCheckpoint(const std::string& path) {
+    CheckpointData data;
+    CHECK(Checkpoint::read(path, data));
+    return data;
+}
+
+} // namespace
+
+int main() {
+    const auto attractions = test::loadProblemData();
+    if (attractions.empty()) return 1;
+    
+    const std::string first = "resume-first.bin";
+    const std::string second = "resume-second.bin";
+    const std::string third = "resume-third.bin";
+    std::remove(first.c_str());
+    
+    // Interrupted run: 6 generations, the last one checkpointed
+    NSGA2Base::RunInfo interrupted;
+    {
+        NSGA2Base nsga2(attractions, testParameters(first, 6));
+        nsga2.run();
+        interrupted = nsga2.getRunInfo();
+    }
+    const auto saved = readCheckpoint(first);
+    CHECK(interrupted.generations == 6);
+    CHECK(saved.generation == 6);
+    CHECK(saved.evaluations == interrupted.evaluations);
+    CHECK(saved.archiveCount() == interrupted.archive_size);
+    
+    // Two resumptions from the same checkpoint must continue identically: the
+    // population, counters and engine state are all taken from the file
+    copyFile(first, second);
+    copyFile(first, third);
+    NSGA2Base::RunInfo resumed;
+    std::vector<Solution> solutions;
+    {
+        NSGA2Base nsga2(attractions, testParameters(second, 12));
+        solutions = nsga2.run();
+        resumed = nsga2.getRunInfo();
+    }
+    {
+        NSGA2Base nsga2(attractions, testParameters(third, 12));
+        const auto repeated_solutions = nsga2.run();
+        CHECK(nsga2.getRunInfo().evaluations == resumed.evaluations);
+        CHECK(repeated_solutions.size() == solutions.size());
+        for (size_t i = 0; i < std::min(solutions.size(), repeated_solutions.size()); ++i) {
+            CHECK(solutions[i].getObjectives() == repeated_solutions[i].getObjectives());
+        }
+    }
+    CHECK(resumed.generations == 12);
+    CHECK(resumed.evaluations > interrupted.evaluations);
+    CHECK(resumed.archive_size > 0);
+    
+    const auto continued = readCheckpoint(second);
+    const auto repeated = readCheckpoint(third);
+    CHECK(continued.generation == 12);
+    CHECK(continued.evaluations == resumed.evaluations);
+    CHECK(continued.rng_state != saved.rng_state);
+    CHECK(continued.rng_state == repeated.rng_state);
+    CHECK(continued.recordCount() == repeated.recordCount());
+    CHECK(continued.archiveCount() == repeated.archiveCount());
+    
+    // A checkpoint cannot be resumed with different settings
+    {
+        auto params = testParameters(first, 12);
+        params.population_size = 30;
+        NSGA2Base nsga2(attractions, params);
+        CHECK_THROWS(nsga2.run());
+    }
+    
+    std::remove(first.c_str());
+    std::remove(second.c_str());
+    std::remove(third.c_str());
+    return test::testResult();
+}
@@ -0,0 +1,66 @@
+// File: tests/test-support.hpp
+// Minimal checks for the test executables: failures are reported and counted,
+// and main() returns the count through testResult()
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+namespace tourist {
+namespace test {
+
+inline int& failures() {
+    static int count = 0;
+    return count;
+}
+
+inline void fail(const char* file, int line, const std::string& message) {
+    std::cerr << file << ":" << line << ": " << message << "\n";
+    ++failures();
+}
+
+// Relative comparison with an absolute floor for values near zero
+inline bool near(double actual, double expected, double tolerance = 1e-9) {
+    return std::abs(actual - expected) <= tolerance * std::max(1.0, std::abs(expected));
+}
+
+inline int testResult() {
+    if (failures() > 0) {
+        std::cerr << failures() << " check(s) failed\n";
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace test
+} // namespace tourist
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) ::tourist::test::fail(__FILE__, __LINE__, "CHECK(" #condition ") failed"); \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance) \
+    do { \
+        const double check_actual_ = (actual); \
+        const double check_expected_ = (expected); \
+        if (!::tourist::test::near(check_actual_, check_expected_, (tolerance))) { \
+            ::tourist::test::fail(__FILE__, __LINE__, "CHECK_NEAR(" #actual ", " #expected "): got " + \
+                                  std::to_string(check_actual_) + ", expected " + \
+                                  std::to_string(check_expected_)); \
+        } \
+    } while (0)
+
+#define CHECK_THROWS(expression) \
+    do { \
+        bool check_threw_ = false; \
+        try { \
+            (void)(expression); \
+        } catch (const std::exception&) { \
+            check_threw_ = true; \
+        } \
+        if (!check_threw_) ::tourist::test::fail(__FILE__, __LINE__, "CHECK_THROWS(" #expression ") did not throw"); \
+    } while (0)
@@ -0,0 +1,47 @@
+// File: tests/thread-pool-test.cpp
+// Every index of every round runs exactly once, and task exceptions reach run()
+
+#include "thread-pool.hpp"
+#include "test-support.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace tourist;
+using utils::ThreadPool;
+
+int main() {
+    ThreadPool pool(4);
+    CHECK(pool.size() == 4);
+    
+    for (size_t count : {0, 1, 3, 1000}) {
+        std::vector<std::atomic<int>> runs(count);
+        std::atomic<bool> worker_in_range{true};
+        pool.run(count, [&](size_t index, size_t worker) {
+            ++runs[index];
+            if (worker >= pool.size()) worker_in_range = false;
+        });
+        for (const auto& value : runs) CHECK(value == 1);
+        CHECK(worker_in_range);
+    }
+    
+    // A failed round does not stop the others from running all their tasks
+    std::atomic<size_t> completed{0};
+    CHECK_THROWS(pool.run(100, [&](size_t index, size_t) {
+        if (index == 17) throw std::runtime_error("task failed");
+        ++completed;
+    }));
+    CHECK(completed == 99);
+    
+    completed = 0;
+    pool.run(50, [&](size_t, size_t) { ++completed; });
+    CHECK(completed == 50);
+    
+    std::vector<int> squares(200, 0);
+    ThreadPool::parallelFor(squares.size(), 0, [&](size_t i) { squares[i] = static_cast<int>(i * i); });
+    for (size_t i = 0; i < squares.size(); ++i) CHECK(squares[i] == static_cast<int>(i * i));
+    CHECK_THROWS(ThreadPool::parallelFor(5, 2, [](size_t) { throw std::runtime_error("task failed"); }));
+    ThreadPool::parallelFor(0, 3, [](size_t) {});
+    
+    return test::testResult();
+}